@@ -0,0 +1,556 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2021 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief Microbenchmarks of the DEM kernels. A synthetic packing (random,
+ * FCC or polydisperse) of a given number of particles is generated in a box
+ * mesh and the broad searches, the localization of the contacts, the fine
+ * search, the contact forces and the integrators are timed in isolation.
+ * The throughput of each kernel is reported in particles/s and, for the
+ * kernels which loop over pairs, in contacts/s.
+ *
+ * Usage: dem_kernels [random|fcc|polydisperse] [number of particles]
+ *                    [number of repetitions]
+ */
+
+// Deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/table_handler.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/fe/mapping_q_generic.h>
+
+#include <deal.II/grid/filtered_iterator.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+// Lethe
+#include <core/memory_report.h>
+#include <dem/dem_properties.h>
+#include <dem/dem_solver_parameters.h>
+#include <dem/explicit_euler_integrator.h>
+#include <dem/find_boundary_cells_information.h>
+#include <dem/find_cell_neighbors.h>
+#include <dem/gear_integrator.h>
+#include <dem/localize_contacts.h>
+#include <dem/locate_local_particles.h>
+#include <dem/pp_broad_search.h>
+#include <dem/pp_fine_search.h>
+#include <dem/pp_linear_force.h>
+#include <dem/pp_nonlinear_force.h>
+#include <dem/pw_broad_search.h>
+#include <dem/update_particle_container.h>
+#include <dem/velocity_verlet_integrator.h>
+
+#include <functional>
+#include <iostream>
+#include <random>
+
+using namespace dealii;
+
+enum class Packing
+{
+  random,
+  fcc,
+  polydisperse
+};
+
+/**
+ * @brief Generates the centers and the diameters of a synthetic packing of
+ * particles of unit mean diameter and returns the length of the cubic box
+ * which contains it. The random and polydisperse packings have a solid
+ * fraction of approximately 0.5 and contain overlapping particles. The
+ * particles of the FCC packing slightly overlap their twelve neighbors.
+ */
+template <int dim>
+double
+generate_packing(const Packing            packing,
+                 const unsigned int       n_particles,
+                 std::vector<Point<dim>> &positions,
+                 std::vector<double> &    diameters)
+{
+  positions.clear();
+  diameters.clear();
+  positions.reserve(n_particles);
+  diameters.reserve(n_particles);
+
+  std::mt19937 generator(0);
+
+  if (packing == Packing::fcc)
+    {
+      // Lattice constant for which neighbor particles overlap by 1% of their
+      // diameter
+      const double       lattice_constant = 0.99 * std::sqrt(2.);
+      const unsigned int basis_size       = (dim == 3) ? 4 : 2;
+      const unsigned int n_unit_cells     = std::ceil(
+        std::pow(double(n_particles) / basis_size, 1. / dim) - 1e-12);
+
+      // Positions of the particles of a unit cell, in lattice units
+      std::vector<Point<dim>> basis(basis_size);
+      basis[1][0] = basis[1][1] = 0.5;
+      if (dim == 3)
+        {
+          basis[2][0] = basis[2][dim - 1] = 0.5;
+          basis[3][1] = basis[3][dim - 1] = 0.5;
+        }
+
+      unsigned int n_lattice_points = 1;
+      for (unsigned int d = 0; d < dim; ++d)
+        n_lattice_points *= n_unit_cells;
+
+      for (unsigned int c = 0; c < n_lattice_points; ++c)
+        {
+          Point<dim>   origin;
+          unsigned int index = c;
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              origin[d] = index % n_unit_cells + 0.25;
+              index /= n_unit_cells;
+            }
+
+          for (const auto &b : basis)
+            if (positions.size() < n_particles)
+              {
+                positions.push_back(
+                  Point<dim>(lattice_constant * (origin + b)));
+                diameters.push_back(1.);
+              }
+        }
+
+      return n_unit_cells * lattice_constant;
+    }
+
+  std::uniform_real_distribution<double> diameter_distribution(0.5, 1.5);
+  for (unsigned int i = 0; i < n_particles; ++i)
+    diameters.push_back(
+      packing == Packing::polydisperse ? diameter_distribution(generator) : 1.);
+
+  double solid_volume = 0;
+  for (const double diameter : diameters)
+    solid_volume += (dim == 3) ? M_PI * Utilities::fixed_power<3>(diameter) / 6.
+                               : M_PI * diameter * diameter / 4.;
+
+  const double box_length = std::pow(solid_volume / 0.5, 1. / dim);
+  const double margin     = 0.75;
+  std::uniform_real_distribution<double> position_distribution(
+    margin, box_length - margin);
+
+  for (unsigned int i = 0; i < n_particles; ++i)
+    {
+      Point<dim> position;
+      for (unsigned int d = 0; d < dim; ++d)
+        position[d] = position_distribution(generator);
+      positions.push_back(position);
+    }
+
+  return box_length;
+}
+
+template <int dim>
+void
+run_benchmarks(const Packing      packing,
+               const unsigned int n_particles,
+               const unsigned int n_repetitions)
+{
+  using pp_contact_map = std::unordered_map<
+    types::particle_index,
+    std::unordered_map<types::particle_index, pp_contact_info_struct<dim>>>;
+  using pw_contact_map = std::unordered_map<
+    types::particle_index,
+    std::map<types::particle_index, pw_contact_info_struct<dim>>>;
+  using candidate_map =
+    std::unordered_map<types::particle_index,
+                       std::vector<types::particle_index>>;
+  using pw_candidate_map = std::unordered_map<
+    types::particle_index,
+    std::unordered_map<types::particle_index,
+                       std::tuple<Particles::ParticleIterator<dim>,
+                                  Tensor<1, dim>,
+                                  Point<dim>,
+                                  unsigned int>>>;
+
+  std::vector<Point<dim>> positions;
+  std::vector<double>     diameters;
+  const double            box_length =
+    generate_packing<dim>(packing, n_particles, positions, diameters);
+  const double maximum_diameter =
+    *std::max_element(diameters.begin(), diameters.end());
+
+  // Box mesh whose cells are at least as large as the neighborhood of the
+  // largest particle, as in the DEM solver
+  const double neighborhood_threshold = 1.3 * maximum_diameter;
+  const unsigned int n_subdivisions =
+    std::max(1, int(box_length / neighborhood_threshold));
+
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  GridGenerator::subdivided_hyper_cube(triangulation,
+                                       n_subdivisions,
+                                       0,
+                                       box_length,
+                                       true);
+
+  // Physical properties of glass beads
+  DEMSolverParameters<dim> dem_parameters;
+  auto &properties = dem_parameters.physical_properties;
+  properties.particle_type_number                     = 1;
+  properties.youngs_modulus_particle[0]               = 1e6;
+  properties.poisson_ratio_particle[0]                = 0.3;
+  properties.restitution_coefficient_particle[0]      = 0.9;
+  properties.friction_coefficient_particle[0]         = 0.3;
+  properties.rolling_friction_coefficient_particle[0] = 0.1;
+  properties.density[0]                               = 2500;
+  dem_parameters.model_parameters.rolling_resistance_method = Parameters::
+    Lagrangian::ModelParameters::RollingResistanceMethod::constant_resistance;
+
+  MappingQGeneric<dim>            mapping(1);
+  Particles::ParticleHandler<dim> particle_handler(
+    triangulation, mapping, DEM::get_number_properties());
+
+  std::mt19937                           generator(1);
+  std::uniform_real_distribution<double> velocity_distribution(-0.01, 0.01);
+
+  std::vector<std::vector<double>> particle_properties;
+  particle_properties.reserve(n_particles);
+  for (const double diameter : diameters)
+    {
+      const double mass = properties.density[0] * M_PI *
+                          Utilities::fixed_power<3>(diameter) / 6.;
+      particle_properties.push_back({0,
+                                     diameter,
+                                     velocity_distribution(generator),
+                                     velocity_distribution(generator),
+                                     velocity_distribution(generator),
+                                     0,
+                                     0,
+                                     0,
+                                     mass});
+    }
+
+  const auto my_bounding_box = GridTools::compute_mesh_predicate_bounding_box(
+    triangulation, IteratorFilters::LocallyOwnedCell());
+  const auto global_bounding_boxes =
+    Utilities::MPI::all_gather(MPI_COMM_WORLD, my_bounding_box);
+  particle_handler.insert_global_particles(positions,
+                                           global_bounding_boxes,
+                                           particle_properties);
+
+  std::unordered_map<types::particle_index, Tensor<1, dim>> momentum;
+  std::unordered_map<types::particle_index, Tensor<1, dim>> force;
+  std::unordered_map<types::particle_index, double>         MOI;
+  for (auto &particle : particle_handler)
+    {
+      const auto particle_properties = particle.get_properties();
+      momentum.insert({particle.get_id(), Tensor<1, dim>()});
+      force.insert({particle.get_id(), Tensor<1, dim>()});
+      MOI.insert({particle.get_id(),
+                  0.1 * particle_properties[DEM::PropertiesIndex::mass] *
+                    particle_properties[DEM::PropertiesIndex::dp] *
+                    particle_properties[DEM::PropertiesIndex::dp]});
+    }
+
+  // Contact containers
+  std::vector<std::vector<typename Triangulation<dim>::active_cell_iterator>>
+    cells_local_neighbor_list;
+  std::vector<std::vector<typename Triangulation<dim>::active_cell_iterator>>
+    cells_ghost_neighbor_list;
+  FindCellNeighbors<dim> cell_neighbors_object;
+  cell_neighbors_object.find_cell_neighbors(triangulation,
+                                            cells_local_neighbor_list,
+                                            cells_ghost_neighbor_list);
+
+  BoundaryCellsInformation<dim> boundary_cell_object;
+  boundary_cell_object.build(triangulation);
+
+  candidate_map  local_contact_pair_candidates, ghost_contact_pair_candidates;
+  pp_contact_map local_adjacent_particles, ghost_adjacent_particles;
+  pw_contact_map pw_pairs_in_contact, pfw_pairs_in_contact;
+  pw_candidate_map pw_contact_candidates;
+  std::unordered_map<
+    types::particle_index,
+    std::unordered_map<types::particle_index, Particles::ParticleIterator<dim>>>
+    pfw_contact_candidates;
+  std::unordered_map<types::particle_index,
+                     particle_point_line_contact_info_struct<dim>>
+    particle_points_in_contact, particle_lines_in_contact;
+  std::unordered_map<types::particle_index, Particles::ParticleIterator<dim>>
+    particle_container;
+
+  PPBroadSearch<dim> pp_broad_search_object;
+  PWBroadSearch<dim> pw_broad_search_object;
+  PPFineSearch<dim>  pp_fine_search_object;
+
+  const auto count_pairs = [](const auto &pair_map) {
+    unsigned long n_pairs = 0;
+    for (const auto &pairs : pair_map)
+      n_pairs += pairs.second.size();
+    return n_pairs;
+  };
+
+  TableHandler table;
+  Timer        timer;
+
+  // Runs a kernel the given number of times and reports its throughput. The
+  // preparation is called before each run and is not timed.
+  const auto benchmark = [&](const std::string &                   kernel,
+                             const std::function<void()> &         preparation,
+                             const std::function<void()> &         run,
+                             const std::function<unsigned long()> &n_pairs) {
+    double wall_time = 0;
+    for (unsigned int r = 0; r < n_repetitions; ++r)
+      {
+        preparation();
+        timer.reset();
+        timer.start();
+        run();
+        timer.stop();
+        wall_time += timer.wall_time();
+      }
+    wall_time /= n_repetitions;
+
+    table.add_value("kernel", kernel);
+    table.add_value("time (s)", wall_time);
+    table.add_value("contacts", static_cast<unsigned int>(n_pairs()));
+    table.add_value("particles/s", n_particles / wall_time);
+    table.add_value("contacts/s", n_pairs() / wall_time);
+  };
+
+  const auto nothing  = []() {};
+  const auto no_pairs = []() { return 0UL; };
+
+  const auto pp_broad_search = [&]() {
+    pp_broad_search_object.find_particle_particle_contact_pairs(
+      particle_handler,
+      &cells_local_neighbor_list,
+      &cells_ghost_neighbor_list,
+      local_contact_pair_candidates,
+      ghost_contact_pair_candidates);
+  };
+  const auto pw_broad_search = [&]() {
+    pw_broad_search_object.find_particle_wall_contact_pairs(
+      boundary_cell_object.get_boundary_cells_information(),
+      particle_handler,
+      pw_contact_candidates);
+  };
+  const auto n_candidates = [&]() {
+    return count_pairs(local_contact_pair_candidates) +
+           count_pairs(ghost_contact_pair_candidates);
+  };
+  const auto n_contacts = [&]() {
+    return count_pairs(local_adjacent_particles) +
+           count_pairs(ghost_adjacent_particles);
+  };
+
+  benchmark("pp_broad_search", nothing, pp_broad_search, n_candidates);
+  benchmark("pw_broad_search", nothing, pw_broad_search, [&]() {
+    return count_pairs(pw_contact_candidates);
+  });
+
+  // The fine search is carried out from an empty contact history, so that
+  // all the contacts of the packing are detected at every repetition
+  const auto pp_fine_search = [&]() {
+    pp_fine_search_object.particle_particle_fine_search(
+      local_contact_pair_candidates,
+      ghost_contact_pair_candidates,
+      local_adjacent_particles,
+      ghost_adjacent_particles,
+      particle_container,
+      neighborhood_threshold * neighborhood_threshold);
+  };
+  const auto clear_contacts = [&]() {
+    local_adjacent_particles.clear();
+    ghost_adjacent_particles.clear();
+    pp_broad_search();
+  };
+  update_particle_container<dim>(particle_container, &particle_handler);
+  benchmark("pp_fine_search", clear_contacts, pp_fine_search, n_contacts);
+
+  // The localization removes the candidates already in contact, hence the
+  // candidates are searched again before each repetition
+  const auto localize = [&]() {
+    localize_contacts<dim>(&local_adjacent_particles,
+                           &ghost_adjacent_particles,
+                           &pw_pairs_in_contact,
+                           &pfw_pairs_in_contact,
+                           local_contact_pair_candidates,
+                           ghost_contact_pair_candidates,
+                           pw_contact_candidates,
+                           pfw_contact_candidates);
+
+    locate_local_particles_in_cells<dim>(particle_handler,
+                                         particle_container,
+                                         ghost_adjacent_particles,
+                                         local_adjacent_particles,
+                                         pw_pairs_in_contact,
+                                         pfw_pairs_in_contact,
+                                         particle_points_in_contact,
+                                         particle_lines_in_contact);
+  };
+  const auto search_candidates = [&]() {
+    pp_broad_search();
+    pw_broad_search();
+  };
+  benchmark("localize_contacts", search_candidates, localize, n_contacts);
+
+  // Contact forces on the contacts of the packing
+  clear_contacts();
+  pp_fine_search();
+  const double dt = 1e-6;
+
+  PPLinearForce<dim>    pp_linear_force_object(dem_parameters);
+  PPNonLinearForce<dim> pp_nonlinear_force_object(dem_parameters);
+  benchmark(
+    "pp_linear_force",
+    nothing,
+    [&]() {
+      pp_linear_force_object.calculate_pp_contact_force(
+        local_adjacent_particles,
+        ghost_adjacent_particles,
+        dt,
+        momentum,
+        force);
+    },
+    n_contacts);
+  benchmark(
+    "pp_nonlinear_force",
+    nothing,
+    [&]() {
+      pp_nonlinear_force_object.calculate_pp_contact_force(
+        local_adjacent_particles,
+        ghost_adjacent_particles,
+        dt,
+        momentum,
+        force);
+    },
+    n_contacts);
+
+  // Integrators. The time step is small enough for the particles to remain in
+  // their cells during the benchmark.
+  Tensor<1, dim> g;
+  std::vector<std::pair<std::string, std::shared_ptr<Integrator<dim>>>>
+    integrators = {
+      {"explicit_euler", std::make_shared<ExplicitEulerIntegrator<dim>>()},
+      {"velocity_verlet", std::make_shared<VelocityVerletIntegrator<dim>>()},
+      {"gear3", std::make_shared<GearIntegrator<dim>>(3)},
+      {"gear5", std::make_shared<GearIntegrator<dim>>(5)}};
+  for (auto &integrator : integrators)
+    benchmark(
+      integrator.first + "_integrator",
+      nothing,
+      [&]() {
+        integrator.second->integrate(
+          particle_handler, g, dt, momentum, force, MOI);
+      },
+      no_pairs);
+
+  table.set_precision("time (s)", 6);
+  table.set_scientific("time (s)", true);
+  table.set_precision("particles/s", 3);
+  table.set_scientific("particles/s", true);
+  table.set_precision("contacts/s", 3);
+  table.set_scientific("contacts/s", true);
+
+  std::cout << "Packing with " << particle_handler.n_global_particles()
+            << " particles in a box of " << triangulation.n_active_cells()
+            << " cells, average over " << n_repetitions << " repetitions"
+            << std::endl;
+  table.write_text(std::cout);
+
+  // Memory of the adjacent pairs and of the history of the contacts, which is
+  // only stored for the pairs in contact
+  std::cout << "Memory of the adjacent pairs: "
+            << container_memory_consumption(local_adjacent_particles) +
+                 container_memory_consumption(ghost_adjacent_particles)
+            << " bytes, memory of the contact histories: "
+            << pp_nonlinear_force_object.contact_histories_memory_consumption()
+            << " bytes for " << n_contacts() << " adjacent pairs" << std::endl;
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      AssertThrow(Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD) == 1,
+                  ExcMessage("The DEM kernel benchmarks run on a single "
+                             "process."));
+
+      if (argc > 4)
+        {
+          std::cout << "Usage:" << argv[0]
+                    << " [random|fcc|polydisperse] [number of particles]"
+                    << " [number of repetitions]" << std::endl;
+          std::exit(1);
+        }
+
+      Packing packing = Packing::random;
+      if (argc > 1)
+        {
+          const std::string packing_name(argv[1]);
+          if (packing_name == "random")
+            packing = Packing::random;
+          else if (packing_name == "fcc")
+            packing = Packing::fcc;
+          else if (packing_name == "polydisperse")
+            packing = Packing::polydisperse;
+          else
+            throw std::runtime_error("Unknown packing: " + packing_name);
+        }
+
+      const unsigned int n_particles =
+        (argc > 2) ? Utilities::string_to_int(argv[2]) : 100000;
+      const unsigned int n_repetitions =
+        (argc > 3) ? Utilities::string_to_int(argv[3]) : 10;
+
+      AssertThrow(n_particles > 0 && n_repetitions > 0,
+                  ExcMessage("The number of particles and the number of "
+                             "repetitions must be positive."));
+
+      run_benchmarks<3>(packing, n_particles, n_repetitions);
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
@@ -0,0 +1,435 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2021 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief Assembly and solver benchmark of the Navier-Stokes solvers. For
+ * every combination of solver, grid, dimension, interpolation order and
+ * linear solver given in the benchmark parameter file, a steady flow driven
+ * by a constant body force in a domain with no-slip walls is solved with a
+ * fixed number of Newton iterations. The throughput in DoFs/s of the
+ * assembly of the matrix and of the right-hand side, of the setup of the
+ * preconditioner and of the Krylov solve is written to a JSON file.
+ *
+ * The GLS solver uses equal order Qk-Qk elements whereas the grad-div solver
+ * uses Taylor-Hood Q(k+1)-Qk elements.
+ *
+ * Usage: navier_stokes_assembly [benchmark_file]
+ */
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/base/timer.h>
+
+#include <solvers/gd_navier_stokes.h>
+#include <solvers/gls_navier_stokes.h>
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+using namespace dealii;
+
+/**
+ * @brief Parameters of the benchmark. Each list defines one dimension of the
+ * matrix of cases that are run.
+ */
+struct BenchmarkParameters
+{
+  std::vector<std::string>  solvers;
+  std::vector<std::string>  grids;
+  std::vector<unsigned int> dimensions;
+  std::vector<unsigned int> degrees;
+  std::vector<std::string>  linear_solvers;
+  unsigned int              refinement_2d;
+  unsigned int              refinement_3d;
+  unsigned int              newton_iterations;
+  std::string               output_file;
+
+  static void
+  declare_parameters(ParameterHandler &prm)
+  {
+    prm.enter_subsection("benchmark");
+    {
+      prm.declare_entry("solvers",
+                        "gls, gd",
+                        Patterns::List(Patterns::Selection("gls|gd")),
+                        "Navier-Stokes solvers which are benchmarked. "
+                        "Choices are <gls|gd>.");
+      prm.declare_entry("grids",
+                        "hyper_cube, hyper_ball",
+                        Patterns::List(
+                          Patterns::Selection("hyper_cube|hyper_ball")),
+                        "Generated grids on which the solvers are "
+                        "benchmarked. Choices are <hyper_cube|hyper_ball>.");
+      prm.declare_entry("dimensions",
+                        "2, 3",
+                        Patterns::List(Patterns::Integer(2, 3)),
+                        "Dimensions of the benchmarks");
+      prm.declare_entry("degrees",
+                        "1, 2",
+                        Patterns::List(Patterns::Integer(1)),
+                        "Interpolation orders of the pressure");
+      prm.declare_entry(
+        "linear solvers",
+        "gmres, bicgstab, amg",
+        Patterns::List(
+          Patterns::Selection("gmres|bicgstab|amg|tfqmr|direct")),
+        "Linear solvers which are benchmarked. The linear solvers which are "
+        "not supported by a Navier-Stokes solver are skipped. Choices are "
+        "<gmres|bicgstab|amg|tfqmr|direct>.");
+      prm.declare_entry("refinement 2d",
+                        "6",
+                        Patterns::Integer(0),
+                        "Number of global refinements of the 2D grids");
+      prm.declare_entry("refinement 3d",
+                        "3",
+                        Patterns::Integer(0),
+                        "Number of global refinements of the 3D grids");
+      prm.declare_entry("newton iterations",
+                        "3",
+                        Patterns::Integer(1),
+                        "Number of Newton iterations of every case");
+      prm.declare_entry("output file",
+                        "navier_stokes_benchmark.json",
+                        Patterns::FileName(),
+                        "Name of the JSON file in which the results are "
+                        "written");
+    }
+    prm.leave_subsection();
+  }
+
+  void
+  parse_parameters(ParameterHandler &prm)
+  {
+    prm.enter_subsection("benchmark");
+    {
+      solvers        = Utilities::split_string_list(prm.get("solvers"));
+      grids          = Utilities::split_string_list(prm.get("grids"));
+      linear_solvers =
+        Utilities::split_string_list(prm.get("linear solvers"));
+
+      dimensions.clear();
+      for (const int dim : Utilities::string_to_int(
+             Utilities::split_string_list(prm.get("dimensions"))))
+        dimensions.push_back(dim);
+
+      degrees.clear();
+      for (const int degree : Utilities::string_to_int(
+             Utilities::split_string_list(prm.get("degrees"))))
+        degrees.push_back(degree);
+
+      refinement_2d     = prm.get_integer("refinement 2d");
+      refinement_3d     = prm.get_integer("refinement 3d");
+      newton_iterations = prm.get_integer("newton iterations");
+      output_file       = prm.get("output file");
+    }
+    prm.leave_subsection();
+  }
+};
+
+/**
+ * @brief Gives access to the dof handler and to the timer of a Navier-Stokes
+ * solver once it has been run.
+ */
+template <int dim, template <int> class Solver>
+class NavierStokesBenchmark : public Solver<dim>
+{
+public:
+  NavierStokesBenchmark(SimulationParameters<dim> &nsparam)
+    : Solver<dim>(nsparam)
+  {}
+
+  types::global_dof_index
+  n_dofs() const
+  {
+    return this->dof_handler.n_dofs();
+  }
+
+  std::map<std::string, double>
+  get_summary_data(const TimerOutput::OutputData kind) const
+  {
+    return this->computing_timer.get_summary_data(kind);
+  }
+};
+
+/**
+ * @brief Timer sections of the solvers which are reported for each stage
+ * of the Newton iterations
+ */
+const std::vector<std::pair<std::string, std::vector<std::string>>> stages = {
+  {"assemble_matrix_and_rhs", {"assemble_system"}},
+  {"assemble_rhs", {"assemble_rhs"}},
+  {"preconditioner_setup", {"setup_ILU", "setup_AMG"}},
+  {"krylov_solve", {"solve_linear_system"}}};
+
+/**
+ * @brief Generates the parameter file of a case of the benchmark
+ */
+template <int dim>
+std::string
+case_parameters(const std::string &grid,
+                const unsigned int refinement,
+                const unsigned int velocity_order,
+                const unsigned int pressure_order,
+                const std::string &linear_solver,
+                const unsigned int newton_iterations)
+{
+  const std::string center = (dim == 2) ? "0, 0" : "0, 0, 0";
+  const std::string force  = (dim == 2) ? "1; 0; 0" : "1; 0; 0; 0";
+
+  std::ostringstream prm;
+  prm << "subsection simulation control\n"
+      << "  set method           = steady\n"
+      << "  set output frequency = 1000000\n"
+      << "end\n"
+      << "subsection timer\n"
+      << "  set type = none\n"
+      << "end\n"
+      << "subsection FEM\n"
+      << "  set velocity order = " << velocity_order << "\n"
+      << "  set pressure order = " << pressure_order << "\n"
+      << "end\n"
+      << "subsection mesh\n"
+      << "  set type               = dealii\n"
+      << "  set grid type          = " << grid << "\n"
+      << "  set grid arguments     = "
+      << (grid == "hyper_ball" ? center + " : 1 : false" : "-1 : 1 : false")
+      << "\n"
+      << "  set initial refinement = " << refinement << "\n"
+      << "end\n"
+      << "subsection boundary conditions\n"
+      << "  set number = 1\n"
+      << "  subsection bc 0\n"
+      << "    set type = noslip\n"
+      << "  end\n"
+      << "end\n"
+      << "subsection source term\n"
+      << "  set enable = true\n"
+      << "  subsection xyz\n"
+      << "    set Function expression = " << force << "\n"
+      << "  end\n"
+      << "end\n"
+      << "subsection non-linear solver\n"
+      << "  set verbosity      = quiet\n"
+      << "  set tolerance      = 0\n"
+      << "  set max iterations = " << newton_iterations << "\n"
+      << "end\n"
+      << "subsection linear solver\n"
+      << "  set verbosity = quiet\n"
+      << "  set method    = " << linear_solver << "\n"
+      << "end\n";
+  return prm.str();
+}
+
+/**
+ * @brief Runs a case of the benchmark and writes its results as a JSON
+ * object
+ */
+template <int dim, template <int> class Solver>
+void
+run_case(const std::string &       solver_name,
+         const std::string &       grid,
+         const unsigned int        refinement,
+         const unsigned int        velocity_order,
+         const unsigned int        pressure_order,
+         const std::string &       linear_solver,
+         const unsigned int        newton_iterations,
+         ConditionalOStream &      pcout,
+         std::vector<std::string> &results)
+{
+  ParameterHandler          prm;
+  SimulationParameters<dim> nsparam;
+  nsparam.declare(prm);
+  prm.parse_input_from_string(case_parameters<dim>(grid,
+                                                   refinement,
+                                                   velocity_order,
+                                                   pressure_order,
+                                                   linear_solver,
+                                                   newton_iterations));
+  nsparam.parse(prm);
+
+  NavierStokesBenchmark<dim, Solver> solver(nsparam);
+  solver.solve();
+
+  const auto wall_times =
+    solver.get_summary_data(TimerOutput::OutputData::total_wall_time);
+  const auto n_calls =
+    solver.get_summary_data(TimerOutput::OutputData::n_calls);
+  const types::global_dof_index n_dofs = solver.n_dofs();
+
+  std::ostringstream json;
+  json << std::setprecision(6);
+  json << "    {\n"
+       << "      \"solver\": \"" << solver_name << "\",\n"
+       << "      \"dimension\": " << dim << ",\n"
+       << "      \"grid\": \"" << grid << "\",\n"
+       << "      \"refinement\": " << refinement << ",\n"
+       << "      \"velocity_order\": " << velocity_order << ",\n"
+       << "      \"pressure_order\": " << pressure_order << ",\n"
+       << "      \"linear_solver\": \"" << linear_solver << "\",\n"
+       << "      \"newton_iterations\": " << newton_iterations << ",\n"
+       << "      \"n_processes\": "
+       << Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD) << ",\n"
+       << "      \"n_dofs\": " << n_dofs << ",\n"
+       << "      \"stages\": {";
+
+  std::ostringstream summary;
+  summary << std::scientific << std::setprecision(3);
+  summary << solver_name << " " << dim << "D " << grid << " Q"
+          << velocity_order << "-Q" << pressure_order << " " << linear_solver
+          << " (" << n_dofs << " DoFs):";
+
+  for (unsigned int s = 0; s < stages.size(); ++s)
+    {
+      double       wall_time = 0;
+      unsigned int calls     = 0;
+      for (const auto &section : stages[s].second)
+        if (wall_times.find(section) != wall_times.end())
+          {
+            wall_time += wall_times.at(section);
+            calls += static_cast<unsigned int>(n_calls.at(section));
+          }
+
+      // The stage is as slow as the slowest process
+      wall_time = Utilities::MPI::max(wall_time, MPI_COMM_WORLD);
+      const double dofs_per_second =
+        (wall_time > 0) ? double(n_dofs) * calls / wall_time : 0;
+
+      json << (s == 0 ? "\n" : ",\n") << "        \"" << stages[s].first
+           << "\": {\"calls\": " << calls << ", \"wall_time\": " << wall_time
+           << ", \"dofs_per_second\": " << dofs_per_second << "}";
+
+      summary << " " << stages[s].first << " " << dofs_per_second
+              << " DoFs/s";
+    }
+  json << "\n      }\n"
+       << "    }";
+  pcout << summary.str() << std::endl;
+
+  results.push_back(json.str());
+}
+
+template <int dim>
+void
+run_benchmarks(const BenchmarkParameters &parameters,
+               ConditionalOStream &       pcout,
+               std::vector<std::string> & results)
+{
+  const unsigned int refinement =
+    (dim == 2) ? parameters.refinement_2d : parameters.refinement_3d;
+
+  for (const auto &solver : parameters.solvers)
+    for (const auto &grid : parameters.grids)
+      for (const unsigned int degree : parameters.degrees)
+        for (const auto &linear_solver : parameters.linear_solvers)
+          {
+            if (solver == "gls")
+              run_case<dim, GLSNavierStokesSolver>(
+                solver,
+                grid,
+                refinement,
+                degree,
+                degree,
+                linear_solver,
+                parameters.newton_iterations,
+                pcout,
+                results);
+            else if (linear_solver == "gmres" || linear_solver == "amg")
+              run_case<dim, GDNavierStokesSolver>(
+                solver,
+                grid,
+                refinement,
+                degree + 1,
+                degree,
+                linear_solver,
+                parameters.newton_iterations,
+                pcout,
+                results);
+            else
+              pcout << "The " << linear_solver << " linear solver is not "
+                    << "supported by the " << solver << " solver, skipping."
+                    << std::endl;
+          }
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      if (argc > 2)
+        {
+          std::cout << "Usage:" << argv[0] << " [benchmark_file]" << std::endl;
+          std::exit(1);
+        }
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(
+        argc, argv, numbers::invalid_unsigned_int);
+
+      ConditionalOStream pcout(
+        std::cout, Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0);
+
+      ParameterHandler    prm;
+      BenchmarkParameters parameters;
+      BenchmarkParameters::declare_parameters(prm);
+      if (argc == 2)
+        prm.parse_input(argv[1]);
+      parameters.parse_parameters(prm);
+
+      std::vector<std::string> results;
+      for (const unsigned int dim : parameters.dimensions)
+        {
+          if (dim == 2)
+            run_benchmarks<2>(parameters, pcout, results);
+          else
+            run_benchmarks<3>(parameters, pcout, results);
+        }
+
+      if (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+        {
+          std::ofstream output(parameters.output_file);
+          output << "{\n  \"benchmarks\": [\n";
+          for (unsigned int i = 0; i < results.size(); ++i)
+            output << results[i] << (i + 1 < results.size() ? ",\n" : "\n");
+          output << "  ]\n}\n";
+        }
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
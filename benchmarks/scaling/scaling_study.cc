@@ -0,0 +1,348 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2021 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief Strong and weak scaling driver of the dem_3d, gls_navier_stokes_3d
+ * and gls_vans_3d applications. The cases are generated from the templates
+ * of the templates directory, whose domain is made of a number of unit slabs
+ * along the x axis. For a weak scaling study, each process holds the same
+ * number of slabs, whereas for a strong scaling study the number of slabs is
+ * that of the weak case at the largest number of processes. Each case is run
+ * with mpirun and the timer summary printed by the application at the end of
+ * the simulation is collected into a table of the wall time and of the
+ * parallel efficiency of every stage.
+ *
+ * The applications must be run with the "end" timer type, which is the case
+ * of the templates.
+ *
+ * Usage: scaling_study scaling_file
+ */
+
+#include <deal.II/base/parameter_handler.h>
+#include <deal.II/base/table_handler.h>
+#include <deal.II/base/utilities.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+
+using namespace dealii;
+
+/**
+ * @brief Parameters of the scaling study
+ */
+struct ScalingParameters
+{
+  enum class Mode
+  {
+    strong,
+    weak
+  };
+
+  std::string               application;
+  std::string               executable;
+  std::string               template_file;
+  Mode                      mode;
+  std::vector<unsigned int> ranks;
+  unsigned int              slabs_per_rank;
+  unsigned int              particles_per_slab;
+  std::string               mpirun;
+  std::string               output_file;
+
+  static void
+  declare_parameters(ParameterHandler &prm)
+  {
+    prm.enter_subsection("scaling");
+    {
+      prm.declare_entry(
+        "application",
+        "gls_navier_stokes_3d",
+        Patterns::Selection("dem_3d|gls_navier_stokes_3d|gls_vans_3d"),
+        "Application whose scaling is studied. "
+        "Choices are <dem_3d|gls_navier_stokes_3d|gls_vans_3d>.");
+      prm.declare_entry("executable",
+                        "",
+                        Patterns::Anything(),
+                        "Path to the executable of the application. The "
+                        "application of the build directory is used if "
+                        "empty.");
+      prm.declare_entry("template file",
+                        "",
+                        Patterns::Anything(),
+                        "Parameter file template of the cases. The template "
+                        "of the application is used if empty.");
+      prm.declare_entry("mode",
+                        "weak",
+                        Patterns::Selection("strong|weak"),
+                        "Type of scaling study. Choices are <strong|weak>.");
+      prm.declare_entry("ranks",
+                        "1, 2, 4, 8",
+                        Patterns::List(Patterns::Integer(1)),
+                        "Numbers of processes with which the cases are run");
+      prm.declare_entry("slabs per rank",
+                        "4",
+                        Patterns::Integer(1),
+                        "Number of unit slabs of the domain per process. "
+                        "For a strong scaling study, this is the number of "
+                        "slabs per process at the largest number of "
+                        "processes.");
+      prm.declare_entry("particles per slab",
+                        "1000",
+                        Patterns::Integer(0),
+                        "Number of particles per slab of the DEM cases");
+      prm.declare_entry("mpirun",
+                        "mpirun -np",
+                        Patterns::Anything(),
+                        "Command which launches the application on a number "
+                        "of processes. The number of processes is appended.");
+      prm.declare_entry("output file",
+                        "scaling.dat",
+                        Patterns::FileName(),
+                        "Name of the file in which the table is written");
+    }
+    prm.leave_subsection();
+  }
+
+  void
+  parse_parameters(ParameterHandler &prm)
+  {
+    prm.enter_subsection("scaling");
+    {
+      application   = prm.get("application");
+      executable    = prm.get("executable");
+      template_file = prm.get("template file");
+
+      if (executable.empty())
+        executable = std::string(LETHE_APPLICATIONS_DIR) + "/" + application +
+                     "/" + application;
+      if (template_file.empty())
+        template_file =
+          std::string(SCALING_TEMPLATES_DIR) + "/" + application + ".prm";
+
+      const std::string op = prm.get("mode");
+      if (op == "strong")
+        mode = Mode::strong;
+      else if (op == "weak")
+        mode = Mode::weak;
+      else
+        throw std::logic_error("Error, invalid scaling mode");
+
+      ranks.clear();
+      for (const int n : Utilities::string_to_int(
+             Utilities::split_string_list(prm.get("ranks"))))
+        ranks.push_back(n);
+      std::sort(ranks.begin(), ranks.end());
+
+      slabs_per_rank     = prm.get_integer("slabs per rank");
+      particles_per_slab = prm.get_integer("particles per slab");
+      mpirun             = prm.get("mpirun");
+      output_file        = prm.get("output file");
+    }
+    prm.leave_subsection();
+  }
+};
+
+/**
+ * @brief Number of calls and wall time of a timer section
+ */
+struct SectionTiming
+{
+  unsigned int calls;
+  double       wall_time;
+};
+
+/**
+ * @brief Reads the timer summary printed at the end of a log file. The
+ * total wall time is stored in the "total" section.
+ *
+ * @param log_file Name of the log file of the application
+ */
+std::map<std::string, SectionTiming>
+read_timer_summary(const std::string &log_file)
+{
+  std::ifstream input(log_file);
+  AssertThrow(input, ExcFileNotOpen(log_file));
+
+  std::map<std::string, SectionTiming> sections;
+  std::string                          line;
+  while (std::getline(input, line))
+    {
+      if (line.empty() || line[0] != '|')
+        continue;
+
+      std::vector<std::string> columns =
+        Utilities::split_string_list(line.substr(1, line.rfind('|') - 1), '|');
+
+      // The summary starts with the total wall time. Only the last summary
+      // of the log is kept.
+      if (columns.size() >= 2 &&
+          columns[0].find("Total wallclock time") == 0)
+        {
+          sections.clear();
+          sections["total"] = {
+            1, Utilities::string_to_double(columns[1].substr(
+                 0, columns[1].find('s')))};
+        }
+      else if (columns.size() == 4 && columns[0] != "Section" &&
+               !columns[1].empty() && !columns[2].empty())
+        {
+          sections[columns[0]] = {
+            static_cast<unsigned int>(Utilities::string_to_int(columns[1])),
+            Utilities::string_to_double(
+              columns[2].substr(0, columns[2].find('s')))};
+        }
+    }
+
+  AssertThrow(sections.find("total") != sections.end(),
+              ExcMessage("No timer summary was found in <" + log_file +
+                         ">. The application must be run with the end "
+                         "timer type."));
+  return sections;
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      if (argc != 2)
+        {
+          std::cout << "Usage:" << argv[0] << " scaling_file" << std::endl;
+          std::exit(1);
+        }
+
+      ParameterHandler  prm;
+      ScalingParameters parameters;
+      ScalingParameters::declare_parameters(prm);
+      prm.parse_input(argv[1]);
+      parameters.parse_parameters(prm);
+
+      std::ifstream template_input(parameters.template_file);
+      AssertThrow(template_input, ExcFileNotOpen(parameters.template_file));
+      const std::string case_template(
+        (std::istreambuf_iterator<char>(template_input)),
+        std::istreambuf_iterator<char>());
+
+      // Timer summary of each number of processes
+      std::map<unsigned int, std::map<std::string, SectionTiming>> timings;
+      std::map<unsigned int, unsigned int>                         slabs;
+
+      for (const unsigned int n_ranks : parameters.ranks)
+        {
+          slabs[n_ranks] =
+            parameters.slabs_per_rank *
+            (parameters.mode == ScalingParameters::Mode::weak ?
+               n_ranks :
+               parameters.ranks.back());
+
+          std::string case_parameters = case_template;
+          case_parameters = Utilities::replace_in_string(
+            case_parameters, "@SLABS@", std::to_string(slabs[n_ranks]));
+          case_parameters = Utilities::replace_in_string(
+            case_parameters,
+            "@PARTICLES@",
+            std::to_string(slabs[n_ranks] * parameters.particles_per_slab));
+
+          const std::string case_name =
+            parameters.application + "_" +
+            Utilities::int_to_string(n_ranks, 4);
+          {
+            std::ofstream case_output(case_name + ".prm");
+            case_output << case_parameters;
+          }
+
+          const std::string command =
+            parameters.mpirun + " " + std::to_string(n_ranks) + " " +
+            parameters.executable + " " + case_name + ".prm > " + case_name +
+            ".log 2>&1";
+          std::cout << "Running " << command << std::endl;
+
+          const int status = std::system(command.c_str());
+          AssertThrow(status == 0,
+                      ExcMessage("The case <" + case_name +
+                                 "> failed, see " + case_name + ".log"));
+
+          timings[n_ranks] = read_timer_summary(case_name + ".log");
+        }
+
+      // Parallel efficiency of each stage with respect to the smallest
+      // number of processes
+      const unsigned int reference_ranks  = parameters.ranks.front();
+      const auto &       reference_timing = timings[reference_ranks];
+
+      TableHandler table;
+      for (const auto &section : reference_timing)
+        for (const unsigned int n_ranks : parameters.ranks)
+          {
+            const auto timing = timings[n_ranks].find(section.first);
+            if (timing == timings[n_ranks].end())
+              continue;
+
+            const double wall_time = timing->second.wall_time;
+            double       efficiency =
+              (wall_time > 0) ? section.second.wall_time / wall_time : 0;
+            if (parameters.mode == ScalingParameters::Mode::strong)
+              efficiency *= double(reference_ranks) / n_ranks;
+
+            table.add_value("stage", section.first);
+            table.add_value("ranks", n_ranks);
+            table.add_value("slabs", slabs[n_ranks]);
+            table.add_value("calls", timing->second.calls);
+            table.add_value("wall time (s)", wall_time);
+            table.add_value("efficiency", efficiency);
+          }
+      table.set_precision("wall time (s)", 4);
+      table.set_precision("efficiency", 3);
+
+      std::cout << (parameters.mode == ScalingParameters::Mode::strong ?
+                      "Strong" :
+                      "Weak")
+                << " scaling of " << parameters.application << std::endl;
+      table.write_text(std::cout, TableHandler::org_mode_table);
+
+      std::ofstream output(parameters.output_file);
+      table.write_text(output);
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
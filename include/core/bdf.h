@@ -60,4 +60,88 @@ bdf_coefficients(unsigned int order, const std::vector<double> time_steps);
 Vector<double>
 delta(unsigned int order, unsigned int n, unsigned int j, Vector<double> times);
 
+/**
+ * @brief Calculate the coefficients of the polynomial extrapolation of the
+ * solution at the present time from the solutions at the previous times. The
+ * extrapolation is exact for polynomials of degree n_points - 1 and supports
+ * variable time steps.
+ *
+ * @param n_points The number of previous solutions used in the extrapolation
+ *
+ * @param time_steps a vector containing all the time steps in reverse order.
+ * The first time step links the last previous solution to the present time.
+ */
+Vector<double>
+extrapolation_coefficients(unsigned int              n_points,
+                           const std::vector<double> time_steps);
+
+/**
+ * @brief Extrapolate the solution at the present time from the solutions at
+ * the previous times, sum_i c_i u_i.
+ *
+ * @param coefficients The extrapolation coefficients of the previous solutions
+ *
+ * @param previous_solutions The solutions at the previous times. Only the
+ * first coefficients.size() solutions are used.
+ *
+ * @param extrapolation A locally owned vector in which the extrapolation is
+ * stored
+ *
+ * @param scratch A locally owned vector used as a temporary
+ */
+template <typename VectorType>
+void
+extrapolate_solution(const Vector<double> &                coefficients,
+                     const std::vector<const VectorType *> previous_solutions,
+                     VectorType &                          extrapolation,
+                     VectorType &                          scratch)
+{
+  AssertIndexRange(coefficients.size() - 1, previous_solutions.size());
+
+  extrapolation = *previous_solutions[0];
+  extrapolation *= coefficients[0];
+  for (unsigned int i = 1; i < coefficients.size(); ++i)
+    {
+      scratch = *previous_solutions[i];
+      extrapolation.add(coefficients[i], scratch);
+    }
+}
+
+/**
+ * @brief Calculate the relative difference between the present solution
+ * and its extrapolation from the previous solutions,
+ * ||u - sum_i c_i u_i|| / ||u||. This difference is the basis of the
+ * estimation of the local truncation error of the BDF schemes.
+ *
+ * @param coefficients The extrapolation coefficients of the previous solutions
+ *
+ * @param present_solution The solution at the present time
+ *
+ * @param previous_solutions The solutions at the previous times. Only the
+ * first coefficients.size() solutions are used.
+ *
+ * @param predictor A locally owned vector used to store the extrapolation
+ *
+ * @param scratch A locally owned vector used as a temporary
+ */
+template <typename VectorType>
+double
+relative_extrapolation_difference(
+  const Vector<double> &                coefficients,
+  const VectorType &                    present_solution,
+  const std::vector<const VectorType *> previous_solutions,
+  VectorType &                          predictor,
+  VectorType &                          scratch)
+{
+  extrapolate_solution(coefficients, previous_solutions, predictor, scratch);
+
+  scratch           = present_solution;
+  const double norm = scratch.l2_norm();
+
+  predictor.sadd(-1., 1., scratch);
+  const double difference = predictor.l2_norm();
+
+  return norm > 0 ? difference / norm : difference;
+}
+
 #endif
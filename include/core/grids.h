@@ -37,6 +37,25 @@
 using namespace dealii;
 
 
+/**
+ * @brief Reads the coarse grid of a GMSH file on the root process and sends
+ * it to all processes of the communicator, which then create their coarse
+ * grid from it. If the cache is enabled in the mesh parameters, the coarse
+ * grid is written in a binary file next to the GMSH file and this file is read
+ * instead of the GMSH file as long as it is more recent than it.
+ *
+ * @param triangulation The triangulation to which the coarse grid is attached
+ *
+ * @param mesh_parameters The mesh parameters which contain the GMSH file name
+ *
+ * @param communicator The communicator of the processes that share the grid
+ */
+template <int dim, int spacedim = dim>
+void
+read_gmsh_coarse_grid(Triangulation<dim, spacedim> &triangulation,
+                      const Parameters::Mesh &      mesh_parameters,
+                      const MPI_Comm &              communicator);
+
 /**
  * @brief Attaches a grid to a triangulation using mesh parameters
  *
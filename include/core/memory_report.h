@@ -0,0 +1,144 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2021 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#ifndef lethe_memory_report_h
+#define lethe_memory_report_h
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/trilinos_precondition.h>
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace dealii;
+
+/**
+ * @brief The MemoryReport class gathers the memory used by the main data
+ * structures of a solver and prints, for each of them, the minimum and the
+ * maximum over the processes. The resident memory of the processes is
+ * reported alongside, since it also accounts for the memory which is not
+ * owned by the listed data structures.
+ */
+class MemoryReport
+{
+public:
+  /**
+   * @brief Adds a data structure to the report
+   *
+   * @param label Name of the data structure
+   * @param bytes Memory used by the data structure on this process
+   */
+  void
+  add_entry(const std::string &label, const std::size_t bytes);
+
+  /**
+   * @brief Prints the report. This function must be called by all the
+   * processes of the communicator.
+   *
+   * @param pcout Stream on which the report is printed
+   * @param mpi_communicator Communicator over which the statistics are taken
+   * @param title Title of the report, for example the stage of the simulation
+   */
+  void
+  print(const ConditionalOStream &pcout,
+        const MPI_Comm &          mpi_communicator,
+        const std::string &       title) const;
+
+private:
+  std::vector<std::pair<std::string, std::size_t>> entries;
+};
+
+/**
+ * @brief Estimates the memory used by the factors of an ILU preconditioner.
+ * Zero is returned if the factorization was not computed.
+ *
+ * @param preconditioner Initialized ILU preconditioner
+ */
+std::size_t
+ilu_memory_consumption(const TrilinosWrappers::PreconditionILU &preconditioner);
+
+/**
+ * @brief Estimates the heap memory used by a standard container and by its
+ * elements. The nodes and buckets of the associative containers are
+ * accounted for with the size of their pointers, which makes this an
+ * estimate of the memory allocated by the standard library.
+ */
+template <typename T>
+std::size_t
+container_memory_consumption(const T &);
+
+template <typename T>
+std::size_t
+container_memory_consumption(const std::vector<T> &container);
+
+template <typename Key, typename Value>
+std::size_t
+container_memory_consumption(const std::map<Key, Value> &container);
+
+template <typename Key, typename Value>
+std::size_t
+container_memory_consumption(const std::unordered_map<Key, Value> &container);
+
+template <typename T>
+std::size_t
+container_memory_consumption(const T &)
+{
+  // Elements which are not containers do not allocate memory
+  return 0;
+}
+
+template <typename T>
+std::size_t
+container_memory_consumption(const std::vector<T> &container)
+{
+  std::size_t bytes = container.capacity() * sizeof(T);
+  for (const auto &element : container)
+    bytes += container_memory_consumption(element);
+  return bytes;
+}
+
+template <typename Key, typename Value>
+std::size_t
+container_memory_consumption(const std::map<Key, Value> &container)
+{
+  // Each node of the tree holds three pointers and its color
+  std::size_t bytes = container.size() * (sizeof(std::pair<const Key, Value>) +
+                                          3 * sizeof(void *) + sizeof(int));
+  for (const auto &element : container)
+    bytes += container_memory_consumption(element.second);
+  return bytes;
+}
+
+template <typename Key, typename Value>
+std::size_t
+container_memory_consumption(const std::unordered_map<Key, Value> &container)
+{
+  // Each node holds the pointer to the next node and the hash of its key
+  std::size_t bytes =
+    container.bucket_count() * sizeof(void *) +
+    container.size() * (sizeof(std::pair<const Key, Value>) +
+                        sizeof(void *) + sizeof(std::size_t));
+  for (const auto &element : container)
+    bytes += container_memory_consumption(element.second);
+  return bytes;
+}
+
+#endif
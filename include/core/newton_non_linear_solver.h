@@ -103,6 +103,7 @@ NewtonNonLinearSolver<VectorType>::solve(
           auto &system_rhs = solver->get_system_rhs();
           current_res      = system_rhs.l2_norm();
           last_res         = current_res;
+          solver->get_telemetry().start_non_linear_solve(current_res);
         }
 
       if (this->params.verbosity != Parameters::Verbosity::quiet)
@@ -113,6 +114,7 @@ NewtonNonLinearSolver<VectorType>::solve(
 
       solver->solve_linear_system(first_step);
       double last_alpha_res = current_res;
+      double retained_alpha = 1.0;
 
       for (double alpha = 1.0; alpha > 1e-1; alpha *= 0.5)
         {
@@ -122,6 +124,7 @@ NewtonNonLinearSolver<VectorType>::solve(
           local_evaluation_point.add(alpha, newton_update);
           solver->apply_constraints();
           evaluation_point = local_evaluation_point;
+          retained_alpha   = alpha;
           solver->assemble_rhs(time_stepping_method);
 
           auto &system_rhs = solver->get_system_rhs();
@@ -145,6 +148,7 @@ NewtonNonLinearSolver<VectorType>::solve(
               local_evaluation_point.add(alpha, newton_update);
               solver->apply_constraints();
               evaluation_point = local_evaluation_point;
+              retained_alpha   = alpha;
 
               if (this->params.verbosity != Parameters::Verbosity::quiet)
                 {
@@ -166,8 +170,11 @@ NewtonNonLinearSolver<VectorType>::solve(
 
       present_solution = evaluation_point;
       last_res         = current_res;
+      solver->get_telemetry().add_newton_iteration(retained_alpha, current_res);
       ++outer_iteration;
     }
+
+  this->n_iterations = outer_iteration;
 }
 
 #endif
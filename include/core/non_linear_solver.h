@@ -68,9 +68,19 @@ public:
         const bool is_initial_step,
         const bool force_matrix_rewewal = true) = 0;
 
+  /**
+   * @brief Number of non-linear iterations carried out by the last solve
+   */
+  unsigned int
+  get_number_of_iterations() const
+  {
+    return n_iterations;
+  }
+
 protected:
   PhysicsSolver<VectorType> * physics_solver;
   Parameters::NonLinearSolver params;
+  unsigned int                n_iterations;
 };
 
 template <typename VectorType>
@@ -79,6 +89,7 @@ NonLinearSolver<VectorType>::NonLinearSolver(
   const Parameters::NonLinearSolver &params)
   : physics_solver(physics_solver)
   , params(params)
+  , n_iterations(0)
 {}
 
 #endif
@@ -97,6 +97,17 @@ namespace Parameters
     // Max CFL
     double adaptative_time_step_scaling;
 
+    // Criterion used to adapt the time step
+    enum class TimeStepAdaptationCriterion
+    {
+      cfl,
+      error
+    } adaptation_criterion;
+
+    // Tolerance on the estimated local truncation error when the time step is
+    // adapted with the error criterion
+    double error_tolerance;
+
     // BDF startup time scaling
     double startup_timestep_scaling;
 
@@ -136,6 +147,19 @@ namespace Parameters
     // Subdivisions of the results in the output
     unsigned int group_files;
 
+    // Write the results on a background thread
+    bool asynchronous_output;
+
+    // File format of the results
+    enum class OutputFormat
+    {
+      vtu,
+      hdf5
+    } output_format;
+
+    // Enable compression of the HDF5 results
+    bool hdf5_compression;
+
     static void
     declare_parameters(ParameterHandler &prm);
     void
@@ -184,6 +208,20 @@ namespace Parameters
     };
 
     Type type;
+
+    // Print the minimum, average and maximum time over the processes of each
+    // section at the end of the simulation
+    bool mpi_statistics;
+
+    // Frequency, in time steps, of the output of the section timings to a CSV
+    // file. The output is disabled if it is zero.
+    unsigned int csv_output_frequency;
+    std::string  csv_output_file;
+
+    // Print the minimum and maximum memory used by the processes for the main
+    // data structures at setup and after each mesh adaptation or load balance
+    bool memory_report;
+
     static void
     declare_parameters(ParameterHandler &prm);
     void
@@ -336,6 +374,22 @@ namespace Parameters
     // Iterations to skip in the non-linear solver
     unsigned int skip_iterations;
 
+    // Extrapolate the initial guess of the non-linear solver from the
+    // solutions of the previous time steps
+    bool extrapolate_initial_guess;
+
+    // Format of the file in which the convergence of the solvers is recorded
+    enum class Telemetry
+    {
+      none,
+      csv,
+      json
+    };
+    Telemetry telemetry;
+
+    // Prefix of the files in which the convergence of the solvers is recorded
+    std::string telemetry_file;
+
     static void
     declare_parameters(ParameterHandler &prm);
     void
@@ -447,6 +501,13 @@ namespace Parameters
     // Target size when automatically refining initial mesh
     double target_size;
 
+    // Number of processes that share a single reader of the GMSH file.
+    // Zero means that a single process reads the file for all processes.
+    unsigned int reader_group_size;
+
+    // Enable the binary cache of the GMSH file
+    bool cache;
+
     static void
     declare_parameters(ParameterHandler &prm);
     void
@@ -468,11 +529,25 @@ namespace Parameters
       kelly
     } type;
 
+    // Variables on which the refinement indicator is calculated. The velocity,
+    // the pressure, the temperature and the tracer use the Kelly estimator,
+    // while the vorticity and the Q-criterion are physical indicators
+    // calculated on each cell from the velocity gradient.
     enum class Variable
     {
       velocity,
-      pressure
-    } variable;
+      pressure,
+      vorticity,
+      q_criterion,
+      temperature,
+      tracer
+    };
+
+    // When more than one variable is given, the indicator of each variable is
+    // normalized by its maximal value and the weighted sum of the normalized
+    // indicators is used for the refinement
+    std::vector<Variable> variables;
+    std::vector<double>   variable_weights;
 
     // Decision factor for Kelly refinement (number or fraction)
     enum class FractionType
@@ -583,6 +658,9 @@ namespace Parameters
     double alpha;
     bool   integrate_motion;
 
+    // Additional weight of a cell cut by a particle when the triangulation is
+    // repartitioned. The repartitioning is not weighted if it is zero.
+    unsigned int cut_cell_weight;
 
 
     static void
@@ -65,6 +65,13 @@ namespace Parameters
     Functions::ParsedFunction<dim> void_fraction;
     bool                           read_dem;
     std::string                    dem_file_name;
+
+    // Replay a sequence of DEM checkpoints instead of a single one
+    bool dem_time_series;
+    // Number of DEM checkpoints in the time series
+    unsigned int dem_time_series_size;
+    // Time interval between two consecutive DEM checkpoints
+    double dem_time_series_period;
   };
 
 
@@ -164,6 +164,35 @@ namespace Parameters
       // Load balance check frequency (for dynamic load-balancing)
       unsigned int dynamic_load_balance_check_frequency;
 
+      // Quantity measuring the imbalance for dynamic load-balancing, either
+      // the number of particles or the time spent on the particles by the
+      // processes
+      enum class DynamicLoadBalanceCriterion
+      {
+        particles,
+        time
+      } dynamic_load_balance_criterion;
+
+      // Cells are weighted by their number of particles, or by their number
+      // of particles and of contacts when the triangulation is repartitioned
+      enum class LoadBalanceWeightType
+      {
+        particles,
+        contacts
+      } load_balance_weight_type;
+
+      // Weight of a particle relative to the weight of a cell (1000) when the
+      // triangulation is repartitioned
+      unsigned int load_balance_particle_weight;
+
+      // Weight of a contact relative to the weight of a cell (1000) when the
+      // triangulation is repartitioned
+      unsigned int load_balance_contact_weight;
+
+      // Enable the calibration of the particle weight from the time measured
+      // on each process before each load balancing
+      bool load_balance_weight_calibration;
+
       // Particle-particle, particle-wall broad and fine search frequency
       unsigned int contact_detection_frequency;
 
@@ -208,9 +237,51 @@ namespace Parameters
       {
         velocity_verlet,
         explicit_euler,
-        gear3
+        gear3,
+        gear5
       } integration_method;
 
+      // Number of sub-steps of the particle-wall contact forces in each DEM
+      // time step. With more than one sub-step, the particle-wall forces are
+      // integrated with a finer time step than the particle-particle forces
+      unsigned int particle_wall_sub_steps;
+
+      // Maximal ratio of the adaptative time step to the Rayleigh time step
+      // of the particles
+      double rayleigh_time_step_ratio;
+
+      // Minimal number of time steps, or of particle-wall sub-steps, in the
+      // Hertzian collision time of a contact when the time step is adapted
+      double collision_time_resolution;
+
+      static void
+      declare_parameters(ParameterHandler &prm);
+      void
+      parse_parameters(ParameterHandler &prm);
+    };
+
+    struct OutputFilter
+    {
+      // Names of the particle fields that are written
+      std::vector<std::string> fields;
+
+      // Only the particles whose id is a multiple of the stride are written
+      unsigned int particle_stride;
+
+      // Enable writing only the particles located inside a box
+      bool region_filter;
+
+      // Output region box info (xmin,xmax,ymin,ymax,zmin,zmax)
+      double x_min, y_min, z_min, x_max, y_max, z_max;
+
+      // Output of the background grid
+      enum class GridOutput
+      {
+        always,
+        once,
+        repartition
+      } grid_output;
+
       static void
       declare_parameters(ParameterHandler &prm);
       void
@@ -27,6 +27,7 @@
 #include "non_linear_solver.h"
 #include "parameters.h"
 #include "skip_newton_non_linear_solver.h"
+#include "solver_telemetry.h"
 
 /**
  * This interface class is used to house all the common elements of physics
@@ -45,8 +46,10 @@ public:
    * @param non_linear_solver_parameters A set of parameters that will be used to construct the non-linear solver
    * @param p_number_physic_total Indicates the number of physics solved
    * default value = 1, meaning only a single physics is solved
+   * @param physics_name Name of the physics appended to the telemetry file
    */
-  PhysicsSolver(const Parameters::NonLinearSolver non_linear_solver_parameters);
+  PhysicsSolver(const Parameters::NonLinearSolver non_linear_solver_parameters,
+                const std::string &physics_name = "fluid_dynamics");
 
   virtual ~PhysicsSolver()
   {
@@ -120,19 +123,71 @@ public:
   virtual AffineConstraints<double> &
   get_nonzero_constraints() = 0;
 
+  /**
+   * @brief Indicate that the initial guess of the next non-linear solve was
+   * extrapolated from the solutions of the previous time steps. This is only
+   * used to report the number of non-linear iterations.
+   */
+  void
+  set_extrapolated_initial_guess()
+  {
+    initial_guess_extrapolated = true;
+  }
+
+  /**
+   * @brief Print the average number of non-linear iterations of all the
+   * solves and the number of solves that started from an extrapolated initial
+   * guess. The solves that start from the solution of the last time step in
+   * the same simulation are the start-up steps, which are the hardest ones,
+   * and are thus not a fair reference. The benefit of the extrapolation must
+   * be measured against a separate simulation with extrapolate initial guess
+   * = false, for example with the solver telemetry.
+   *
+   * @param physics_name Name of the physics displayed in the report
+   */
+  void
+  print_non_linear_iterations_summary(const std::string &physics_name);
+
+  /**
+   * @brief Telemetry in which the non-linear and linear solvers record their
+   * convergence
+   */
+  SolverTelemetry &
+  get_telemetry()
+  {
+    return telemetry;
+  }
+
   // attributes
   // TODO std::unique or std::shared pointer
   ConditionalOStream pcout;
 
 private:
   NonLinearSolver<VectorType> *non_linear_solver;
+
+  // Statistics of the non-linear iterations
+  bool         initial_guess_extrapolated;
+  unsigned int n_non_linear_solves;
+  unsigned int n_extrapolated_non_linear_solves;
+  unsigned int n_non_linear_iterations;
+
+  SolverTelemetry telemetry;
 };
 
 template <typename VectorType>
 PhysicsSolver<VectorType>::PhysicsSolver(
-  const Parameters::NonLinearSolver non_linear_solver_parameters)
+  const Parameters::NonLinearSolver non_linear_solver_parameters,
+  const std::string &               physics_name)
   : pcout({std::cout, Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0})
+  , initial_guess_extrapolated(false)
+  , n_non_linear_solves(0)
+  , n_extrapolated_non_linear_solves(0)
+  , n_non_linear_iterations(0)
 {
+  telemetry.initialize(non_linear_solver_parameters.telemetry,
+                       non_linear_solver_parameters.telemetry_file + "_" +
+                         physics_name);
+
   switch (non_linear_solver_parameters.solver)
     {
       case Parameters::NonLinearSolver::SolverType::newton:
@@ -164,5 +219,27 @@ PhysicsSolver<VectorType>::solve_non_linear_system(
                                    first_iteration,
                                    force_matrix_renewal);
   }
+
+  n_non_linear_solves += 1;
+  if (initial_guess_extrapolated)
+    n_extrapolated_non_linear_solves += 1;
+  n_non_linear_iterations +=
+    this->non_linear_solver->get_number_of_iterations();
+  initial_guess_extrapolated = false;
+}
+
+template <typename VectorType>
+void
+PhysicsSolver<VectorType>::print_non_linear_iterations_summary(
+  const std::string &physics_name)
+{
+  const double average =
+    n_non_linear_solves > 0 ?
+      static_cast<double>(n_non_linear_iterations) / n_non_linear_solves :
+      0.;
+  pcout << physics_name << " - average number of non-linear iterations : "
+        << average << " (" << n_non_linear_solves << " solves, "
+        << n_extrapolated_non_linear_solves
+        << " from an extrapolated initial guess)" << std::endl;
 }
 #endif
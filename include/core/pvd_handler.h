@@ -33,7 +33,9 @@ class PVDHandler
 {
 public:
   /**
-   * @brief save Saves the content of the pvd times_and_names to a file
+   * @brief save Saves the content of the pvd times_and_names to a file.
+   * If the file was already saved by this PVDHandler, only the entries
+   * appended since the previous save are written at the end of the file.
    *
    * @param filename Name of the file to which the PVDHandler content is save
    */
@@ -48,6 +50,17 @@ public:
   void
   read(std::string filename);
 
+  /**
+   * @brief write_pvd Writes the pvd file which stores the time associated
+   * with each pvtu file. If the pvd file was already written by this
+   * PVDHandler, only the entries appended since the previous write are
+   * written, in place of the closing tags of the file.
+   *
+   * @param pvd_filename Name of the pvd file including the folder
+   */
+  void
+  write_pvd(const std::string &pvd_filename);
+
   void
   append(double time, std::string pvtu_filename)
   {
@@ -58,6 +71,15 @@ public:
   // The name of the pvtu files and the time associated with each file
   // is stored in a simple vector of pairs.
   std::vector<std::pair<double, std::string>> times_and_names;
+
+private:
+  // Number of entries and name of the last pvd file written
+  unsigned int n_entries_written = 0;
+  std::string  written_pvd_filename;
+
+  // Number of entries and name of the last checkpoint file saved
+  unsigned int n_entries_saved = 0;
+  std::string  saved_filename;
 };
 
 #endif
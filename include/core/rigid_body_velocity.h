@@ -0,0 +1,115 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2021 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#ifndef lethe_rigid_body_velocity_h
+#define lethe_rigid_body_velocity_h
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/tensor.h>
+
+#include <deal.II/lac/vector.h>
+
+using namespace dealii;
+
+/**
+ * @brief Velocity field of a rigid body in translation and in rotation
+ * around a center of rotation, u = U + omega x (x - x_c(t)). The center of
+ * rotation moves with the body, x_c(t) = x_c0 + U t, where t is the time of
+ * the function. Contrary to a parsed function, the velocity is evaluated
+ * without any expression parser, which makes it suitable for the motion of a
+ * large number of points.
+ *
+ * @tparam dim An integer that denotes the dimension of the space
+ */
+template <int dim>
+class RigidBodyVelocity : public Function<dim>
+{
+public:
+  /**
+   * @param translational_velocity Translational velocity of the body
+   * @param angular_velocity Angular velocity of the body. This is always a 3D
+   * tensor. In 2D, only its z component is used
+   * @param center_of_rotation Center of rotation of the body at time 0
+   */
+  RigidBodyVelocity(const Tensor<1, dim> &translational_velocity,
+                    const Tensor<1, 3> &  angular_velocity,
+                    const Point<dim> &    center_of_rotation)
+    : Function<dim>(dim)
+    , translational_velocity(translational_velocity)
+    , angular_velocity(angular_velocity)
+    , center_of_rotation(center_of_rotation)
+  {}
+
+  virtual double
+  value(const Point<dim> &p, const unsigned int component) const override
+  {
+    return velocity(p)[component];
+  }
+
+  virtual void
+  vector_value(const Point<dim> &p, Vector<double> &values) const override
+  {
+    const Tensor<1, dim> u = velocity(p);
+    for (unsigned int d = 0; d < dim; ++d)
+      values[d] = u[d];
+  }
+
+  virtual void
+  vector_value_list(const std::vector<Point<dim>> &points,
+                    std::vector<Vector<double>> &  values) const override
+  {
+    AssertDimension(points.size(), values.size());
+    for (unsigned int i = 0; i < points.size(); ++i)
+      vector_value(points[i], values[i]);
+  }
+
+  /**
+   * @brief Returns true if the body neither translates nor rotates
+   */
+  bool
+  is_at_rest() const
+  {
+    return translational_velocity.norm() == 0 && angular_velocity.norm() == 0;
+  }
+
+private:
+  Tensor<1, dim>
+  velocity(const Point<dim> &p) const
+  {
+    const Tensor<1, dim> r =
+      p - (center_of_rotation + this->get_time() * translational_velocity);
+    Tensor<1, dim>       u = translational_velocity;
+    if (dim == 2)
+      {
+        u[0] -= angular_velocity[2] * r[1];
+        u[1] += angular_velocity[2] * r[0];
+      }
+    else if (dim == 3)
+      {
+        u[0] += angular_velocity[1] * r[2] - angular_velocity[2] * r[1];
+        u[1] += angular_velocity[2] * r[0] - angular_velocity[0] * r[2];
+        u[2] += angular_velocity[0] * r[1] - angular_velocity[1] * r[0];
+      }
+    return u;
+  }
+
+  const Tensor<1, dim> translational_velocity;
+  const Tensor<1, 3>   angular_velocity;
+  const Point<dim>     center_of_rotation;
+};
+
+#endif
@@ -192,6 +192,42 @@ public:
     return time_step;
   }
 
+  /**
+   * @brief Number of previous solutions with which the solution at the present
+   * time can be extrapolated. This is the order of the BDF scheme plus one,
+   * limited by max_n_points and by the number of time steps already carried
+   * out. Returns 0 if the time stepping method is not a transient BDF scheme
+   * or if fewer than two previous solutions are available.
+   *
+   * @param max_n_points Maximal number of previous solutions used
+   */
+  unsigned int
+  get_extrapolation_n_points(const unsigned int max_n_points = 3) const;
+
+  /**
+   * @brief Number of previous solutions with which the solvers must
+   * extrapolate their solution to estimate the local truncation error of the
+   * present time step. The base function returns 0, which indicates that no
+   * error estimate is required.
+   */
+  virtual unsigned int
+  get_error_estimate_n_points()
+  {
+    return 0;
+  }
+
+  /**
+   * @brief Provide the relative difference between the solution of a physics
+   * and its extrapolation from the previous solutions. This difference is
+   * used to estimate the local truncation error when the time step is
+   * controlled by the error. The base function does nothing.
+   *
+   * @param relative_difference Relative difference calculated by the solver
+   */
+  virtual void
+  provide_error_estimate(const double /*relative_difference*/)
+  {}
+
 
   /**
    * @brief print_progress Function that prints the current progress status of the simulation
@@ -356,9 +392,9 @@ public:
 
 
 
-  void
+  virtual void
   save(std::string filename);
-  void
+  virtual void
   read(std::string filename);
 };
 
@@ -407,9 +443,31 @@ public:
 
 /**
  * @brief Transient simulation control tailored around the discrete element method
+ *
+ * With adaptative time stepping, the DEM solver sets the CFL as the ratio of
+ * the time step to the critical time step of the particles and their contacts
+ * (Rayleigh time step and Hertzian collision time). The time step is then
+ * bound by the maximal CFL times the critical time step.
  */
 class SimulationControlTransientDEM : public SimulationControlTransient
 {
+protected:
+  /**
+   * @brief Calculates the next value of the time step. If adaptation
+   * is enabled, the new time step is equal to adaptative_time_step_scaling *
+   * the previous time step, and is scaled down if it surpasses the critical
+   * time step of the DEM. The CFL set by the DEM solver is the ratio of the
+   * time step to the critical time step, which already includes the
+   * fractions of the Rayleigh time step and of the collision time given in
+   * the model parameters, so the maximal CFL is not used. Since the critical
+   * time step is bounded by the Rayleigh time step of the particles, the
+   * time step is bounded with or without contacts. The time step is kept
+   * constant as long as the solver has not set the CFL, for instance before
+   * the insertion of the particles.
+   */
+  virtual double
+  calculate_time_step() override;
+
 public:
   SimulationControlTransientDEM(Parameters::SimulationControl param);
 
@@ -450,6 +508,81 @@ public:
   is_output_iteration() override;
 };
 
+/**
+ * @brief Transient simulation control in which the time step is controlled by
+ * an estimate of the local truncation error of the BDF schemes instead of the
+ * CFL condition. At the end of every time step, each physics compares its
+ * solution with its polynomial extrapolation from the previous time steps.
+ * The largest difference, scaled by the error constants of the BDF scheme, is
+ * used by a PI controller to calculate the next time step. Time steps are not
+ * rejected, the controller only adapts the following time step.
+ */
+class SimulationControlTransientErrorControlled
+  : public SimulationControlTransient
+{
+protected:
+  // Tolerance on the estimated local truncation error
+  double error_tolerance;
+
+  // Estimated local truncation error of the present time step. A negative
+  // value indicates that no estimate was provided.
+  double error_estimate;
+
+  // Estimated local truncation error of the previous time step
+  double previous_error_estimate;
+
+  // Number of previous solutions used in the extrapolation of the present
+  // time step
+  unsigned int error_estimate_n_points;
+
+  // Iteration at which the simulation was restarted, 0 if it was not
+  unsigned int restart_iteration_number;
+
+  /**
+   * @brief Calculates the next value of the time step with a PI controller
+   * from the error estimates of the present and of the previous time steps.
+   * The growth of the time step is bounded by adaptative_time_step_scaling.
+   */
+  virtual double
+  calculate_time_step() override;
+
+public:
+  SimulationControlTransientErrorControlled(
+    Parameters::SimulationControl param);
+
+  virtual void
+  print_progression(const ConditionalOStream &pcout) override;
+
+  /**
+   * @brief The estimate uses the order of the BDF scheme plus one previous
+   * solutions, up to the four previous solutions stored by the solvers, so
+   * that the estimate has the order of the local truncation error
+   */
+  virtual unsigned int
+  get_error_estimate_n_points() override;
+
+  /**
+   * @brief Keeps the largest error among all the physics solved during the
+   * present time step
+   */
+  virtual void
+  provide_error_estimate(const double relative_difference) override;
+
+  /**
+   * @brief Also saves the state of the time step controller, so that a
+   * restarted simulation continues with the same time step control
+   */
+  virtual void
+  save(std::string filename) override;
+
+  /**
+   * @brief Also reads the state of the time step controller. It is left
+   * unchanged if the checkpoint does not contain it.
+   */
+  virtual void
+  read(std::string filename) override;
+};
+
 class SimulationControlSteady : public SimulationControl
 {
 public:
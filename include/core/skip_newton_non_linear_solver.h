@@ -88,6 +88,7 @@ SkipNewtonNonLinearSolver<VectorType>::solve(
         {
           current_res = system_rhs.l2_norm();
           last_res    = current_res;
+          solver->get_telemetry().start_non_linear_solve(current_res);
         }
 
       if (this->params.verbosity != Parameters::Verbosity::quiet)
@@ -97,6 +98,7 @@ SkipNewtonNonLinearSolver<VectorType>::solve(
         }
 
       solver->solve_linear_system(first_step, assembly_needed);
+      double retained_alpha = 1.0;
 
       for (double alpha = 1.0; alpha > 1e-3; alpha *= 0.5)
         {
@@ -106,6 +108,7 @@ SkipNewtonNonLinearSolver<VectorType>::solve(
           local_evaluation_point.add(alpha, newton_update);
           solver->apply_constraints();
           evaluation_point = local_evaluation_point;
+          retained_alpha   = alpha;
           solver->assemble_rhs(time_stepping_method);
 
           current_res = system_rhs.l2_norm();
@@ -126,9 +129,12 @@ SkipNewtonNonLinearSolver<VectorType>::solve(
 
       present_solution = evaluation_point;
       last_res         = current_res;
+      solver->get_telemetry().add_newton_iteration(retained_alpha, current_res);
       ++outer_iteration;
       assembly_needed = false;
     }
+  this->n_iterations = outer_iteration;
+
   if (!force_matrix_renewal)
     {
       consecutive_iters++;
@@ -44,6 +44,7 @@
 
 // Lethe Includes
 #include <core/parameters.h>
+#include <core/rigid_body_velocity.h>
 #include <solvers/simulation_parameters.h>
 
 // Std
@@ -137,15 +138,21 @@ public:
 
   /**
    * @brief Updates particle positions in solid_particle_handler by integrating velocity using a Runge-Kutta method
+   *
+   * @param time_step The time step
+   * @param initial_time The time at the beginning of the time step
    */
   void
-  integrate_velocity(double time_step);
+  integrate_velocity(double time_step, const double initial_time);
 
   /**
    * @brief Moves the dofs of the solid_triangulation
+   *
+   * @param time_step The time step
+   * @param initial_time The time at the beginning of the time step
    */
   void
-  move_solid_triangulation(double time_step);
+  move_solid_triangulation(double time_step, const double initial_time);
 
   /**
    * @brief prints the positions of the particles
@@ -155,6 +162,35 @@ public:
 
 
 private:
+  /**
+   * @brief Moves a set of points with the solid velocity using a Runge-Kutta
+   * method. At every stage, the velocity of all the points is evaluated in a
+   * single call, at the time of the stage. The time of the velocity is left at
+   * the end of the time step.
+   *
+   * @param points The points to move
+   * @param initial_time The time at the beginning of the time step
+   * @param time_step The time step
+   */
+  void
+  integrate_points_rk4(std::vector<Point<spacedim>> &points,
+                       const double                  initial_time,
+                       const double                  time_step) const;
+
+  /**
+   * @brief Returns true if the solid is known not to move, in which case its
+   * particles and its triangulation do not need to be moved nor sorted
+   */
+  bool
+  is_at_rest() const;
+
+  /**
+   * @brief Checks if a locally owned particle has left the fluid cell in
+   * which it was last sorted. This is a collective operation.
+   */
+  bool
+  particles_left_their_cell() const;
+
   // Member variables
   MPI_Comm           mpi_communicator;
   const unsigned int n_mpi_processes;
@@ -170,6 +206,10 @@ private:
 
   Function<spacedim> *velocity;
 
+  // Compiled velocity field used instead of the parsed function for rigid
+  // body motion
+  std::shared_ptr<RigidBodyVelocity<spacedim>> rigid_body_velocity;
+
   const unsigned int degree_velocity;
   unsigned int       initial_number_of_particles;
 };
@@ -27,6 +27,10 @@
 // Lethe includes
 #include <core/pvd_handler.h>
 
+// Std
+#include <future>
+#include <memory>
+
 using namespace dealii;
 
 
@@ -66,6 +70,68 @@ write_vtu_and_pvd(PVDHandler &                           pvd_handler,
                   const MPI_Comm &                       mpi_communicator,
                   const unsigned int                     digits = 4);
 
+/**
+ * @brief Output the data out to a single hdf5 file, with an xdmf file to store the timing
+ * This function writes the mesh and the data of all the ranks collectively
+ * in a single hdf5 file. An additional xdmf file references every hdf5 file
+ * along with the time associated with it.
+ *
+ * @param xdmf_entries the entries of the previous outputs, to which the entry of this output is appended
+ *
+ * @param data_out the DataOut class to which the data has been attached
+ *
+ * @param folder a string that contains the path where the results are to be saved
+ *
+ * @param file_prefix a string that stores the name of the file without the iteration number and the extension
+ *
+ * @param time the time associated with the file
+ *
+ * @param iter the iteration number associated with the file
+ *
+ * @param compression enables the compression of the data in the hdf5 file
+ *
+ * @param mpi_communicator The mpi communicator
+ *
+ * @param digits An optional parameter that specifies the amount of digit used to store iteration number in the file name
+ */
+template <int dim, int spacedim = dim>
+void
+write_hdf5_and_xdmf(std::vector<XDMFEntry> &         xdmf_entries,
+                    DataOutInterface<dim, spacedim> &data_out,
+                    const std::string                folder,
+                    const std::string                file_prefix,
+                    const double                     time,
+                    const unsigned int               iter,
+                    const bool                       compression,
+                    const MPI_Comm &                 mpi_communicator,
+                    const unsigned int               digits = 4);
+
+/**
+ * @brief Saves the xdmf entries of the previous outputs to a checkpoint file.
+ * Like the PVDHandler, this allows the xdmf file to keep the outputs written
+ * before a restart.
+ *
+ * @param xdmf_entries the entries of the previous outputs
+ *
+ * @param prefix the prefix of the checkpoint files
+ */
+void
+save_xdmf_entries(const std::vector<XDMFEntry> &xdmf_entries,
+                  const std::string &           prefix);
+
+/**
+ * @brief Reads the xdmf entries of the previous outputs from a checkpoint file.
+ * The entries are cleared if the checkpoint does not contain any, for example
+ * when it was written by an older version.
+ *
+ * @param xdmf_entries the entries of the previous outputs
+ *
+ * @param prefix the prefix of the checkpoint files
+ */
+void
+read_xdmf_entries(std::vector<XDMFEntry> &xdmf_entries,
+                  const std::string &     prefix);
+
 /**
  * @brief Output the Data Out Faces to a single vtu file
  * This function outputs the DataOutFaces to a vtu file.
@@ -89,4 +155,100 @@ write_boundaries_vtu(const DataOutFaces<dim> &data_out,
                      const MPI_Comm &         mpi_communicator,
                      const std::string  file_prefix = std::string("boundaries"),
                      const unsigned int digits      = 4);
+
+/**
+ * @brief DataOut whose patches can be detached from the DoFHandler, the data
+ * vectors and the postprocessors they were built from. Once detached, the
+ * DataOut only holds the patches and the names of the data sets and can be
+ * written while the solver modifies the mesh and the solution.
+ */
+template <int dim>
+class DetachedDataOut : public DataOut<dim>
+{
+public:
+  /**
+   * @brief Takes ownership of the patches that were built and releases
+   * everything that was attached to the DataOut. This must be called after
+   * build_patches.
+   */
+  void
+  detach();
+
+protected:
+  virtual const std::vector<DataOutBase::Patch<dim, dim>> &
+  get_patches() const override;
+
+  virtual std::vector<std::string>
+  get_dataset_names() const override;
+
+  virtual std::vector<
+    std::tuple<unsigned int,
+               unsigned int,
+               std::string,
+               DataComponentInterpretation::DataComponentInterpretation>>
+  get_nonscalar_data_ranges() const override;
+
+private:
+  bool                                      detached = false;
+  std::vector<DataOutBase::Patch<dim, dim>> detached_patches;
+  std::vector<std::string>                  detached_dataset_names;
+  std::vector<
+    std::tuple<unsigned int,
+               unsigned int,
+               std::string,
+               DataComponentInterpretation::DataComponentInterpretation>>
+    detached_nonscalar_data_ranges;
+};
+
+/**
+ * @brief Writes the results of a DetachedDataOut on a background thread.
+ * Every rank writes its own vtu file, so no communication takes place on the
+ * background thread, and rank 0 writes the .pvtu and .pvd files. A new output
+ * only blocks if the previous one has not been written yet.
+ */
+template <int dim>
+class AsynchronousVTUWriter
+{
+public:
+  ~AsynchronousVTUWriter();
+
+  /**
+   * @brief Detaches the data out and writes it on a background thread
+   *
+   * @param pvd_handler a PVDHandler to store the information about the file name and time associated with it
+   *
+   * @param data_out the DataOut on which build_patches has been called
+   *
+   * @param folder a string that contains the path where the results are to be saved
+   *
+   * @param file_prefix a string that stores the name of the file without the iteration number and the extension
+   *
+   * @param time the time associated with the file
+   *
+   * @param iter the iteration number associated with the file
+   *
+   * @param mpi_communicator The mpi communicator
+   *
+   * @param digits An optional parameter that specifies the amount of digit used to store iteration number in the file name
+   */
+  void
+  write_vtu_and_pvd(PVDHandler &                          pvd_handler,
+                    std::shared_ptr<DetachedDataOut<dim>> data_out,
+                    const std::string                     folder,
+                    const std::string                     file_prefix,
+                    const double                          time,
+                    const unsigned int                    iter,
+                    const MPI_Comm &                      mpi_communicator,
+                    const unsigned int                    digits = 4);
+
+  /**
+   * @brief Waits until the output in progress, if any, is written
+   */
+  void
+  wait();
+
+private:
+  std::future<void> pending_write;
+};
+
 #endif
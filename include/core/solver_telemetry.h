@@ -0,0 +1,133 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2021 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#ifndef lethe_solver_telemetry_h
+#define lethe_solver_telemetry_h
+
+#include "parameters.h"
+
+using namespace dealii;
+
+/**
+ * @brief The SolverTelemetry class records the convergence of the
+ * non-linear and linear solvers of a physics: the residuals and the
+ * line-search relaxation of every Newton iteration, the number of iterations
+ * of every linear solve, the time spent in the setup of the preconditioners
+ * and the number of times the fill level of the ILU preconditioner had to be
+ * increased. The records are written to a file by the first process at the
+ * end of every time step, one line per non-linear solve. In the json format,
+ * each line is a self-contained JSON object.
+ *
+ * Nothing is recorded unless the telemetry was initialized.
+ */
+class SolverTelemetry
+{
+public:
+  SolverTelemetry();
+
+  /**
+   * @brief Enables the telemetry and creates its output file
+   *
+   * @param format Format of the output file
+   * @param file_prefix Prefix of the output file. The extension of the format
+   * is appended
+   */
+  void
+  initialize(const Parameters::NonLinearSolver::Telemetry format,
+             const std::string &                          file_prefix);
+
+  bool
+  is_enabled() const
+  {
+    return enabled;
+  }
+
+  /**
+   * @brief Starts the record of a non-linear solve
+   *
+   * @param initial_residual Residual before the first Newton iteration
+   */
+  void
+  start_non_linear_solve(const double initial_residual);
+
+  /**
+   * @brief Records a Newton iteration
+   *
+   * @param alpha Relaxation of the Newton update retained by the line search
+   * @param residual Residual at the end of the iteration
+   */
+  void
+  add_newton_iteration(const double alpha, const double residual);
+
+  /**
+   * @brief Records a linear solve
+   *
+   * @param n_iterations Number of iterations of the linear solver
+   */
+  void
+  add_linear_solve(const unsigned int n_iterations);
+
+  /**
+   * @brief Records the setup of a preconditioner
+   *
+   * @param wall_time Wall time of the setup
+   */
+  void
+  add_preconditioner_setup(const double wall_time);
+
+  /**
+   * @brief Records that the linear solver failed and was restarted with a
+   * higher fill level of the ILU preconditioner
+   */
+  void
+  add_fill_increase();
+
+  /**
+   * @brief Writes the records of the non-linear solves of the time step and
+   * clears them
+   *
+   * @param step_number Number of the time step
+   * @param time Time at the end of the time step
+   */
+  void
+  write(const unsigned int step_number, const double time);
+
+private:
+  struct NonLinearSolveRecord
+  {
+    double                    initial_residual = 0;
+    std::vector<double>       alphas;
+    std::vector<double>       residuals;
+    std::vector<unsigned int> linear_iterations;
+    unsigned int              n_preconditioner_setups   = 0;
+    double                    preconditioner_setup_time = 0;
+    unsigned int              n_fill_increases          = 0;
+  };
+
+  /**
+   * @brief Returns the record of the current non-linear solve. A record is
+   * started if linear systems are solved outside of a non-linear solve.
+   */
+  NonLinearSolveRecord &
+  current_record();
+
+  bool                                  enabled;
+  Parameters::NonLinearSolver::Telemetry format;
+  std::string                           file_name;
+  std::vector<NonLinearSolveRecord>     records;
+};
+
+#endif
@@ -17,6 +17,7 @@
  * Author: Bruno Blais, Shahab Golshan, Polytechnique Montreal, 2019-
  */
 
+#include <deal.II/base/data_out_base.h>
 #include <deal.II/base/tensor.h>
 #include <deal.II/base/timer.h>
 
@@ -26,6 +27,7 @@
 
 #include <deal.II/particles/particle_handler.h>
 
+#include <core/memory_report.h>
 #include <core/pvd_handler.h>
 #include <dem/dem_properties.h>
 #include <dem/dem_solver_parameters.h>
@@ -33,13 +35,15 @@
 #include <dem/find_boundary_cells_information.h>
 #include <dem/find_cell_neighbors.h>
 #include <dem/find_contact_detection_step.h>
+#include <dem/find_critical_time_step.h>
 #include <dem/find_maximum_particle_size.h>
-#include <dem/gear3_integrator.h>
+#include <dem/gear_integrator.h>
 #include <dem/input_parameter_inspection.h>
 #include <dem/integrator.h>
 #include <dem/localize_contacts.h>
 #include <dem/locate_ghost_particles.h>
 #include <dem/locate_local_particles.h>
+#include <dem/multiple_time_step_integrator.h>
 #include <dem/non_uniform_insertion.h>
 #include <dem/particle_point_line_broad_search.h>
 #include <dem/particle_point_line_contact_force.h>
@@ -64,8 +68,10 @@
 #include <dem/visualization.h>
 #include <dem/write_checkpoint.h>
 
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <unordered_set>
 
 #ifndef Lethe_DEM_h
@@ -118,6 +124,29 @@ private:
     const typename parallel::distributed::Triangulation<dim>::CellStatus status)
     const;
 
+  /**
+   * @brief Weight of an active cell for load balancing, from its number of
+   * particles and, with the contacts weight type, from the number of
+   * contacts of these particles. The weight is calculated in a 64-bit
+   * integer, since the weights of the particles and of the contacts may be
+   * large, and is clamped to the largest weight accepted by p4est by
+   * cell_weight.
+   *
+   * @param cell The active cell
+   */
+  std::uint64_t
+  active_cell_weight(
+    const typename Triangulation<dim>::active_cell_iterator &cell) const;
+
+  /**
+   * @brief Number of particle-particle, particle-wall and particle-floating
+   * wall contacts stored for a particle
+   *
+   * @param id Id of the particle
+   */
+  unsigned int
+  n_particle_contacts(const types::particle_index id) const;
+
   /**
    * Finds contact search steps for constant contact search method
    */
@@ -162,6 +191,19 @@ private:
   void
   load_balance();
 
+  /**
+   * @brief Calibrates the weights of the particles, and of the contacts with
+   * the contacts weight type, for load balancing. The average time per step
+   * spent by each process on its particles since the last load balancing is
+   * fitted, in the least-squares sense over all the processes, by a linear
+   * function of its number of cells, of particles and of contacts. The ratio
+   * of the coefficients gives the weights relative to the weight of a cell.
+   * The weights are left unchanged if the fit is not meaningful, for instance
+   * if all the processes have the same proportion of particles and cells.
+   */
+  void
+  calibrate_load_balance_weights();
+
   /**
    * @brief Manages the call to the particle insertion. Returns true if
    * particles were inserted
@@ -198,9 +240,11 @@ private:
   /**
    * @brief Calculates particles-wall contact forces
    *
+   * @param dt Time step used for the update of the tangential overlaps, which
+   * is a sub-step of the DEM time step with particle-wall sub-steps
    */
   void
-  particle_wall_contact_force();
+  particle_wall_contact_force(const double dt);
 
   /**
    * @brief finish_simulation
@@ -262,6 +306,23 @@ private:
   void
   write_output_results();
 
+  /**
+   * @brief Appends to a CSV file the minimum, average and maximum over the
+   * processes of the wall time spent in each stage of the DEM engine since
+   * the previous call. The columns are the timer sections entered by any
+   * process before the first call, so that the header of the file stays
+   * valid
+   */
+  void
+  write_timer_statistics();
+
+  /**
+   * @brief Prints the minimum and maximum memory used by the processes for
+   * the triangulation, the particles and the contact containers
+   */
+  void
+  print_memory_usage();
+
 
   MPI_Comm                                  mpi_communicator;
   const unsigned int                        n_mpi_processes;
@@ -356,12 +417,14 @@ private:
   ParticlePointLineFineSearch<dim>     particle_point_line_fine_search_object;
   ParticlePointLineForce<dim>          particle_point_line_contact_force_object;
   std::shared_ptr<Integrator<dim>>     integrator_object;
+  MultipleTimeStepIntegrator<dim>      multiple_time_step_integrator_object;
   std::shared_ptr<Insertion<dim>>      insertion_object;
   std::shared_ptr<PPContactForce<dim>> pp_contact_force_object;
   std::shared_ptr<PWContactForce<dim>> pw_contact_force_object;
   Visualization<dim>                   visualization_object;
   FindCellNeighbors<dim>               cell_neighbors_object;
   PVDHandler                           particles_pvdhandler;
+  std::vector<XDMFEntry>               particles_xdmf_entries;
   const unsigned int                   standard_deviation_multiplier;
 
   std::unordered_map<types::particle_index, Tensor<1, dim>> momentum;
@@ -370,8 +433,29 @@ private:
   std::unordered_map<types::particle_index, double>         MOI;
 
   // Information for parallel grid processing
-  DoFHandler<dim> background_dh;
-  PVDHandler      grid_pvdhandler;
+  DoFHandler<dim>        background_dh;
+  PVDHandler             grid_pvdhandler;
+  std::vector<XDMFEntry> grid_xdmf_entries;
+
+  // Write the background grid at the next output
+  bool background_grid_output_required;
+
+  // Weights of a particle and of a contact for load balancing
+  unsigned int particle_weight;
+  unsigned int contact_weight;
+
+  // Time spent on the particles since the last load balancing, which is used
+  // to calibrate the weights and to detect load imbalance
+  const bool   measure_particle_work;
+  Timer        particle_work_timer;
+  double       particle_work_particles;
+  double       particle_work_contacts;
+  unsigned int particle_work_steps;
+  double       particle_work_time_at_check;
+
+  // Wall time of the timer sections at the previous CSV timer output
+  std::map<std::string, double> previous_section_wall_times;
+  bool                          timer_statistics_output_started;
 };
 
 #endif
@@ -0,0 +1,121 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2021 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <dem/dem_properties.h>
+#include <dem/dem_solver_parameters.h>
+#include <dem/pp_contact_info_struct.h>
+#include <dem/pw_contact_info_struct.h>
+
+#include <map>
+#include <unordered_map>
+
+using namespace dealii;
+
+#ifndef find_critical_time_step_h
+#  define find_critical_time_step_h
+
+/**
+ * Calculates the Rayleigh time step of a particle, which is the time
+ * required by a shear wave to travel through the particle
+ *
+ * @param diameter Diameter of the particle
+ * @param density Density of the particle
+ * @param youngs_modulus Young's modulus of the particle
+ * @param poisson_ratio Poisson's ratio of the particle
+ * @return The Rayleigh time step
+ */
+double
+rayleigh_time_step(const double diameter,
+                   const double density,
+                   const double youngs_modulus,
+                   const double poisson_ratio);
+
+/**
+ * Calculates the duration of a Hertzian collision, which increases as the
+ * normal impact velocity decreases
+ *
+ * @param effective_mass Effective mass of the contact pair
+ * @param effective_radius Effective radius of the contact pair
+ * @param effective_youngs_modulus Effective Young's modulus of the contact
+ * pair
+ * @param normal_impact_velocity Magnitude of the normal relative velocity of
+ * the contact pair
+ * @return The duration of the collision. The maximal double is returned if the
+ * impact velocity is zero
+ */
+double
+hertz_collision_time(const double effective_mass,
+                     const double effective_radius,
+                     const double effective_youngs_modulus,
+                     const double normal_impact_velocity);
+
+/**
+ * Carries out finding the critical time step of the DEM, which is the
+ * largest stable time step. It is the minimum of a fraction of the Rayleigh
+ * time steps of the particles, calculated with their own diameter, and of a
+ * fraction of the Hertzian collision times of the particle-particle and
+ * particle-wall contacts, calculated with their normal relative velocity.
+ * The Rayleigh time steps bound the critical time step with or without
+ * contacts. When the particle-wall contact forces are integrated with
+ * sub-steps of the time step, the particle-wall collision times bound the
+ * sub-step rather than the time step. The critical time step is reduced over
+ * all the processes.
+ *
+ * @param particle_handler
+ * @param physical_properties DEM physical properties
+ * @param local_adjacent_particles Local-local particle-particle contacts
+ * @param ghost_adjacent_particles Local-ghost particle-particle contacts
+ * @param pw_pairs_in_contact Particle-wall contacts
+ * @param pfw_pairs_in_contact Particle-floating wall contacts
+ * @param rayleigh_time_step_ratio Maximal ratio of the time step to the
+ * Rayleigh time step
+ * @param collision_time_resolution Minimal number of time steps, or of
+ * particle-wall sub-steps, in a collision time
+ * @param n_wall_sub_steps Number of sub-steps of the particle-wall contact
+ * forces in each time step
+ * @param mpi_communicator
+ * @return The critical time step, or the maximal double if there is neither
+ * particle nor contact
+ */
+template <int dim>
+double
+find_critical_time_step(
+  Particles::ParticleHandler<dim> &                      particle_handler,
+  const Parameters::Lagrangian::PhysicalProperties<dim> &physical_properties,
+  const std::unordered_map<
+    types::particle_index,
+    std::unordered_map<types::particle_index, pp_contact_info_struct<dim>>>
+    &local_adjacent_particles,
+  const std::unordered_map<
+    types::particle_index,
+    std::unordered_map<types::particle_index, pp_contact_info_struct<dim>>>
+    &ghost_adjacent_particles,
+  const std::unordered_map<
+    types::particle_index,
+    std::map<types::particle_index, pw_contact_info_struct<dim>>>
+    &pw_pairs_in_contact,
+  const std::unordered_map<
+    types::particle_index,
+    std::map<types::particle_index, pw_contact_info_struct<dim>>>
+    &                pfw_pairs_in_contact,
+  const double       rayleigh_time_step_ratio,
+  const double       collision_time_resolution,
+  const unsigned int n_wall_sub_steps,
+  const MPI_Comm &   mpi_communicator);
+
+#endif
@@ -0,0 +1,182 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2019 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+
+ *
+ * Author: Bruno Blais, Polytechnique Montreal, 2019
+ */
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <dem/dem_solver_parameters.h>
+#include <dem/integrator.h>
+
+#include <array>
+
+using namespace dealii;
+
+#ifndef gear_integrator_h
+#  define gear_integrator_h
+
+/**
+ * Implementation of the Gear predictor-corrector schemes of order 3 and 5
+ * for the integration of the particle motion. Note that reinitilization of
+ * force and torque is also integrated into integration class
+ *
+ * @note In a Gear scheme of order q, the position of a particle and its
+ * first q time derivatives are predicted at the next time step using a Taylor
+ * expansion. The forces are then calculated at the predicted positions and
+ * velocities, and the difference between the acceleration obtained from the
+ * forces and the predicted acceleration corrects all the derivatives. With
+ * r(k) = dt ^ k / k! * d^k x / dt^k:
+ *
+ * Prediction:
+ * r(k, n+1, prediction) = sum_{j >= k} j! / (k! (j-k)!) * r(j, n)
+ *
+ * delta_r2(n+1) = dt ^ 2 / 2 * (F(n+1) / m - a(n+1, prediction))
+ *
+ * Correction:
+ * r(k, n+1) = r(k, n+1, prediction) + eta_k * delta_r2(n+1)
+ *
+ * where eta = {1/6, 5/6, 1, 1/3} for the third order scheme and
+ * eta = {3/20, 251/360, 1, 11/18, 1/6, 1/60} for the fifth order scheme. The
+ * first coefficient of the fifth order scheme is the one of forces which
+ * depend on the velocity, as the damped contact forces of the DEM.
+ *
+ * In the DEM engine, the integrator corrects the state predicted at the
+ * previous step with the forces of the current step, then predicts the
+ * position and the velocity of the next step. The acceleration and its
+ * derivatives are stored in a history of the integrator indexed by the id of
+ * the particles rather than in the property pool. The history of a particle
+ * which was just inserted or which has just been received from another
+ * process is started from its current acceleration, with derivatives of the
+ * acceleration which are zero unless they were given with
+ * start_particle_history. The angular velocity is integrated with the
+ * explicit Euler method.
+ *
+ * @author Shahab Golshan, Bruno Blais, Polytechnique Montreal 2019-
+ */
+
+template <int dim>
+class GearIntegrator : public Integrator<dim>
+{
+public:
+  /**
+   * @param order Order of the scheme, 3 or 5
+   */
+  GearIntegrator(const unsigned int order);
+
+  /**
+   * Starts the history of all the particles from their acceleration and
+   * predicts their location at the end of the first time step.
+   *
+   * @param particle_handler The particle handler whose particle motion we wish
+   * to integrate
+   * @param body_force A constant volumetric body force applied to all particles
+   * @param force Force acting on particles
+   * @param time_step The value of the time step used for the integration
+   */
+  virtual void
+  integrate_half_step_location(
+    Particles::ParticleHandler<dim> &                          particle_handler,
+    Tensor<1, dim> &                                           body_force,
+    std::unordered_map<types::particle_index, Tensor<1, dim>> &force,
+    double time_step) override;
+
+  /**
+   * Carries out the integration of the motion of all
+   * particles by using the Gear method.
+   *
+   * @param particle_handler The particle handler whose particle motion we wish
+   * to integrate
+   * @param body_force A constant volumetric body force applied to all particles
+   * @param time_step The value of the time step used for the integration
+   * @param momentum Momentum of particles
+   * @param force Force acting on particles
+   * @param MOI A container of moment of inertia of particles
+   */
+  virtual void
+  integrate(Particles::ParticleHandler<dim> &particle_handler,
+            Tensor<1, dim> &                 body_force,
+            double                           time_step,
+            std::unordered_map<types::particle_index, Tensor<1, dim>> &momentum,
+            std::unordered_map<types::particle_index, Tensor<1, dim>> &force,
+            std::unordered_map<types::particle_index, double> &MOI) override;
+
+  /**
+   * Gives the derivatives of the acceleration of a particle with which its
+   * history is started at its next integration, instead of zero. Starting
+   * the history from zero derivatives limits the accuracy of the scheme
+   * during the first time steps.
+   *
+   * @param particle_id Id of the particle
+   * @param acceleration_derivatives First, second, ... time derivatives of
+   * the acceleration of the particle, at least order - 2 of them
+   */
+  void
+  start_particle_history(
+    const types::particle_index        particle_id,
+    const std::vector<Tensor<1, dim>> &acceleration_derivatives);
+
+private:
+  // Maximal number of derivatives of the position stored in the history,
+  // from the acceleration to the fifth derivative
+  static const unsigned int max_n_history = 4;
+
+  /**
+   * Acceleration and its derivatives predicted for a particle, with the
+   * integration call at which they were predicted
+   */
+  struct ParticleHistory
+  {
+    std::array<Tensor<1, dim>, max_n_history> derivatives;
+    unsigned int                              update;
+  };
+
+  /**
+   * Corrects the state of the particles with the acceleration obtained from
+   * the forces and predicts their state at the end of the time step. The
+   * forces are reinitialized.
+   *
+   * @param particle_handler The particle handler whose particle motion we wish
+   * to integrate
+   * @param body_force A constant volumetric body force applied to all particles
+   * @param force Force acting on particles
+   * @param time_step The value of the time step used for the prediction
+   */
+  void
+  correct_and_predict(
+    Particles::ParticleHandler<dim> &                          particle_handler,
+    const Tensor<1, dim> &                                     body_force,
+    std::unordered_map<types::particle_index, Tensor<1, dim>> &force,
+    const double                                               time_step);
+
+  const unsigned int  order;
+  std::vector<double> corrector_coefficients;
+
+  std::unordered_map<types::particle_index, ParticleHistory> history;
+
+  // Derivatives of the acceleration given by start_particle_history for the
+  // particles whose history has not been started yet
+  std::unordered_map<types::particle_index,
+                     std::array<Tensor<1, dim>, max_n_history - 1>>
+    initial_derivatives;
+
+  // Number of calls of correct_and_predict and time step of the last
+  // prediction
+  unsigned int n_updates;
+  double       prediction_time_step;
+};
+
+#endif
@@ -0,0 +1,142 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2021 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <dem/dem_solver_parameters.h>
+
+using namespace dealii;
+
+#ifndef multiple_time_step_integrator_h
+#  define multiple_time_step_integrator_h
+
+/**
+ * Implementation of a multiple time step (r-RESPA) velocity verlet scheme in
+ * which the particle-wall contact forces, which are usually the stiffest, are
+ * integrated with a sub-step of the time step used for the particle-particle
+ * contact forces and the body force. Note that reinitilization of force and
+ * torque is also integrated into integration class
+ *
+ * @note In each time step dt, the impulse of the slow forces is applied on the
+ * velocity of the particles, then the motion of the particles is integrated in
+ * n sub-steps of dt / n with the fast forces:
+ *
+ * v = v + a_slow * dt
+ *
+ * n times:
+ * v = v + a_fast * dt / n
+ * x = x + v      * dt / n
+ *
+ * where a_fast is evaluated at the position of the particles at the beginning
+ * of each sub-step. In the first time step, the velocity is only advanced by
+ * half of the impulses, as for the velocity verlet integrator. With a single
+ * sub-step, this scheme is identical to the velocity verlet integrator.
+ */
+
+template <int dim>
+class MultipleTimeStepIntegrator
+{
+public:
+  /**
+   * @param n_sub_steps Number of sub-steps of the fast forces in each time
+   * step
+   */
+  MultipleTimeStepIntegrator(const unsigned int n_sub_steps);
+
+  /**
+   * Applies the impulse of the slow forces (particle-particle contact forces
+   * and body force) on the velocity of the particles. The location of the
+   * particles is not modified.
+   *
+   * @param particle_handler The particle handler whose particle motion we wish
+   * to integrate
+   * @param body_force A constant volumetric body force applied to all particles
+   * @param time_step The value of the time step used for the integration
+   * @param momentum Momentum of particles
+   * @param force Force acting on particles
+   * @param MOI A container of moment of inertia of particles
+   * @param first_step Only half of the impulse is applied in the first step
+   */
+  void
+  integrate_slow_forces(
+    Particles::ParticleHandler<dim> &                          particle_handler,
+    const Tensor<1, dim> &                                     body_force,
+    const double                                               time_step,
+    std::unordered_map<types::particle_index, Tensor<1, dim>> &momentum,
+    std::unordered_map<types::particle_index, Tensor<1, dim>> &force,
+    std::unordered_map<types::particle_index, double> &        MOI,
+    const bool                                                 first_step);
+
+  /**
+   * Carries out a sub-step of the integration of the motion of the particles
+   * with the fast forces (particle-wall contact forces).
+   *
+   * @param particle_handler The particle handler whose particle motion we wish
+   * to integrate
+   * @param sub_time_step The value of the sub-step used for the integration
+   * @param momentum Momentum of particles
+   * @param force Force acting on particles
+   * @param MOI A container of moment of inertia of particles
+   * @param first_step Only half of the impulse is applied in the first
+   * sub-step of the simulation
+   */
+  void
+  integrate_fast_forces(
+    Particles::ParticleHandler<dim> &                          particle_handler,
+    const double                                               sub_time_step,
+    std::unordered_map<types::particle_index, Tensor<1, dim>> &momentum,
+    std::unordered_map<types::particle_index, Tensor<1, dim>> &force,
+    std::unordered_map<types::particle_index, double> &        MOI,
+    const bool                                                 first_step);
+
+  /**
+   * Returns the number of sub-steps in each time step
+   */
+  inline unsigned int
+  get_n_sub_steps() const
+  {
+    return n_sub_steps;
+  }
+
+  /**
+   * Returns the sub-step of the fast forces
+   *
+   * @param time_step The value of the time step of the slow forces
+   */
+  inline double
+  get_sub_time_step(const double time_step) const
+  {
+    return time_step / n_sub_steps;
+  }
+
+private:
+  /**
+   * Applies an impulse on the velocity and the angular velocity of the
+   * particles and reinitializes the force and the torque
+   */
+  void
+  apply_impulse(
+    Particles::ParticleHandler<dim> &                          particle_handler,
+    const Tensor<1, dim> &                                     body_force,
+    const double                                               impulse_time,
+    std::unordered_map<types::particle_index, Tensor<1, dim>> &momentum,
+    std::unordered_map<types::particle_index, Tensor<1, dim>> &force,
+    std::unordered_map<types::particle_index, double> &        MOI);
+
+  const unsigned int n_sub_steps;
+};
+
+#endif
@@ -73,13 +73,34 @@ public:
     std::unordered_map<types::particle_index, Tensor<1, dim>> &momentum,
     std::unordered_map<types::particle_index, Tensor<1, dim>> &force) = 0;
 
+  /**
+   * @brief Returns the history of the particle-particle contacts, which is
+   * stored for the pairs in contact only and indexed by the history index of
+   * the adjacent pairs
+   */
+  const std::vector<pp_contact_history_struct<dim>> &
+  get_contact_histories() const
+  {
+    return contact_histories;
+  }
+
+  /**
+   * @brief Returns the memory used by the history of the contacts
+   */
+  std::size_t
+  contact_histories_memory_consumption() const
+  {
+    return (contact_histories.capacity() +
+            previous_contact_histories.capacity()) *
+           sizeof(pp_contact_history_struct<dim>);
+  }
+
 protected:
   /**
    * @brief Carries out updating the contact pair information for both non-linear and
    * linear contact force calculations
    *
-   * @param adjacent_pair_information Contact information of a particle pair in
-   * neighborhood
+   * @param contact_history History of the contact of a particle pair
    * @param particle_one_properties Properties of particle one in contact
    * @param particle_two_properties Properties of particle two in contact
    * @param particle_one_location Location of particle one in contact
@@ -88,14 +109,65 @@ protected:
    */
   void
   update_contact_information(
-    pp_contact_info_struct<dim> &  adjacent_pair_information,
-    double &                       normal_relative_velocity_value,
-    Tensor<1, dim> &               normal_unit_vector,
-    const ArrayView<const double> &particle_one_properties,
-    const ArrayView<const double> &particle_two_properties,
-    const Point<dim> &             particle_one_location,
-    const Point<dim> &             particle_two_location,
-    const double &                 dt);
+    pp_contact_history_struct<dim> &contact_history,
+    double &                        normal_relative_velocity_value,
+    Tensor<1, dim> &                normal_unit_vector,
+    const ArrayView<const double> & particle_one_properties,
+    const ArrayView<const double> & particle_two_properties,
+    const Point<dim> &              particle_one_location,
+    const Point<dim> &              particle_two_location,
+    const double &                  dt);
+
+  /**
+   * @brief Starts a calculation of the contact forces. The histories of the
+   * previous calculation are kept until the pairs in contact are found in the
+   * adjacent particles
+   */
+  void
+  start_contact_histories_update()
+  {
+    contact_histories.swap(previous_contact_histories);
+    contact_histories.clear();
+  }
+
+  /**
+   * @brief Returns the history of a pair of particles in contact, which is
+   * moved at the end of the histories of the current calculation of the
+   * contact forces. The history of a pair which was not in contact at the
+   * previous calculation is started with zero tangential overlap and
+   * tangential relative velocity. The reference is valid until the next call
+   *
+   * @param contact_info Adjacent pair in contact, whose history index is
+   * updated
+   */
+  inline pp_contact_history_struct<dim> &
+  find_contact_history(pp_contact_info_struct<dim> &contact_info)
+  {
+    if (contact_info.history_index == numbers::invalid_unsigned_int)
+      contact_histories.emplace_back();
+    else
+      {
+        AssertIndexRange(contact_info.history_index,
+                         previous_contact_histories.size());
+        contact_histories.push_back(
+          previous_contact_histories[contact_info.history_index]);
+      }
+
+    contact_info.history_index = contact_histories.size() - 1;
+    return contact_histories.back();
+  }
+
+  /**
+   * @brief Drops the history of a pair of adjacent particles which are not in
+   * contact
+   *
+   * @param contact_info Adjacent pair which is not in contact
+   */
+  inline void
+  expire_contact_history(pp_contact_info_struct<dim> &contact_info)
+  {
+    contact_info.history_index = numbers::invalid_unsigned_int;
+  }
 
   /**
    * @brief Carries out applying the calculated force and torque on the local-local
@@ -195,6 +267,13 @@ protected:
          effective_coefficient_of_rolling_friction;
   double effective_radius;
   double effective_mass;
+
+  // History of the contacts, stored only for the pairs in contact in the
+  // order in which the contact forces are calculated, and history of the
+  // previous calculation. The histories of the pairs which are not in contact
+  // anymore, or not adjacent anymore, are not moved to the current histories
+  std::vector<pp_contact_history_struct<dim>> contact_histories;
+  std::vector<pp_contact_history_struct<dim>> previous_contact_histories;
 };
 
 #endif /* particle_particle_contact_force_h */
@@ -17,6 +17,7 @@
  * Author: Shahab Golshan, Polytechnique Montreal, 2019
  */
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/types.h>
 
 #include <deal.II/particles/particle_iterator.h>
 
@@ -24,8 +25,11 @@
 #  define particle_particle_contact_info_struct_h
 
 /**
- * This struct handles the information related to the calculation of the
- * particle-particle contact force
+ * This struct handles the pair of particles in the neighborhood of each other
+ * which is found in the fine search. It holds the particle iterators and the
+ * index of the history of the contact, which is stored separately by the
+ * contact force classes (see pp_contact_history_struct), or an invalid index
+ * if the particles are not in contact
  */
 
 using namespace dealii;
@@ -33,10 +37,20 @@ using namespace dealii;
 template <int dim>
 struct pp_contact_info_struct
 {
-  Tensor<1, dim>                   tangential_relative_velocity;
-  Tensor<1, dim>                   tangential_overlap;
   Particles::ParticleIterator<dim> particle_one;
   Particles::ParticleIterator<dim> particle_two;
+  unsigned int history_index = numbers::invalid_unsigned_int;
+};
+
+/**
+ * This struct handles the history of a particle-particle contact. It is only
+ * stored for the pairs which are in contact
+ */
+template <int dim>
+struct pp_contact_history_struct
+{
+  Tensor<1, dim> tangential_relative_velocity;
+  Tensor<1, dim> tangential_overlap;
 };
 
 #endif /* particle_particle_contact_info_struct_h */
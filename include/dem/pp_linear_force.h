@@ -205,10 +205,10 @@ private:
 
   /**
    * Carries out the calculation of the particle-particle linear contact
-   * force and torques based on the updated values in contact_info
+   * force and torques based on the updated values in contact_history
    *
-   * @param contact_info A container that contains the required information for
-   * calculation of the contact force for a particle pair in contact
+   * @param contact_history History of the contact of a particle pair, which
+   * is updated if the contact slides
    * @param normal_relative_velocity_value Normal relative contact velocity
    * @param normal_unit_vector Contact normal unit vector
    * @param normal_overlap Contact normal overlap
@@ -221,16 +221,16 @@ private:
    */
   void
   calculate_linear_contact_force_and_torque(
-    pp_contact_info_struct<dim> &  contact_info,
-    const double &                 normal_relative_velocity_value,
-    const Tensor<1, dim> &         normal_unit_vector,
-    const double &                 normal_overlap,
-    const ArrayView<const double> &particle_one_properties,
-    const ArrayView<const double> &particle_two_properties,
-    Tensor<1, dim> &               normal_force,
-    Tensor<1, dim> &               tangential_force,
-    Tensor<1, dim> &               tangential_torque,
-    Tensor<1, dim> &               rolling_resistance_torque);
+    pp_contact_history_struct<dim> &contact_history,
+    const double &                  normal_relative_velocity_value,
+    const Tensor<1, dim> &          normal_unit_vector,
+    const double &                  normal_overlap,
+    const ArrayView<const double> & particle_one_properties,
+    const ArrayView<const double> & particle_two_properties,
+    Tensor<1, dim> &                normal_force,
+    Tensor<1, dim> &                tangential_force,
+    Tensor<1, dim> &                tangential_torque,
+    Tensor<1, dim> &                rolling_resistance_torque);
 
   // Normal and tangential contact forces, tangential and rolling torques,
   // normal unit vector of the contact and contact relative velocity in the
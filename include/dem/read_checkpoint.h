@@ -27,6 +27,7 @@
 #include <boost/archive/text_oarchive.hpp>
 
 #include <core/pvd_handler.h>
+#include <core/solutions_output.h>
 #include <dem/dem_solver_parameters.h>
 
 #include <fstream>
@@ -45,6 +46,8 @@ using namespace std;
  * @param dem_parameters Input DEM parameters in the parameter handler file
  * @param simulation_control Simulation control
  * @param particles_pvdhandler PVD handler
+ * @param particles_xdmf Xdmf entries of the particle outputs
+ * @param grid_xdmf Xdmf entries of the grid outputs
  * @param triangulation Triangulation
  * @param particle_handler Particle handler
  */
@@ -54,6 +57,8 @@ read_checkpoint(TimerOutput &                              computing_timer,
                 const DEMSolverParameters<dim> &           dem_parameters,
                 std::shared_ptr<SimulationControl> &       simulation_control,
                 PVDHandler &                               particles_pvdhandler,
+                std::vector<XDMFEntry> &                   particles_xdmf,
+                std::vector<XDMFEntry> &                   grid_xdmf,
                 parallel::distributed::Triangulation<dim> &triangulation,
                 Particles::ParticleHandler<dim> &          particle_handler);
 
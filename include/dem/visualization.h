@@ -58,10 +58,14 @@ public:
    * element and the size of the property as the second element. For vectors
    * only the size of the first element of the vector is defined equal to the
    * dimension
+   * @param output_filter Fields and particles that are written. Only the
+   * particles whose id is a multiple of the particle stride and, if the region
+   * filter is enabled, that are located inside the region box are written
    */
   void
-  build_patches(Particles::ParticleHandler<dim> &        particle_handler,
-                std::vector<std::pair<std::string, int>> properties);
+  build_patches(Particles::ParticleHandler<dim> &           particle_handler,
+                std::vector<std::pair<std::string, int>>    properties,
+                const Parameters::Lagrangian::OutputFilter &output_filter);
 
   /**
    * Prints the data of particles in the xyz format
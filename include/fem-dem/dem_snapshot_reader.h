@@ -0,0 +1,120 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2021 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#ifndef lethe_dem_snapshot_reader_h
+#define lethe_dem_snapshot_reader_h
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <core/boundary_conditions.h>
+#include <core/manifolds.h>
+#include <core/parameters.h>
+
+#include <future>
+#include <memory>
+#include <string>
+
+using namespace dealii;
+
+/**
+ * Reads a time series of DEM checkpoints for one-way coupled VANS
+ * simulations. Snapshot k of the series is the DEM checkpoint named
+ * <dem file name>.XXXXX where XXXXX is k on five digits.
+ *
+ * Since the particles of a DEM checkpoint are stored alongside its
+ * triangulation, every snapshot is loaded into an auxiliary triangulation,
+ * copied from the coarse mesh read once at construction, and the particles
+ * are then inserted in the particle handler of the fluid solver. The files
+ * of the next snapshot can be read on a background thread while the fluid is
+ * being solved, so that the collective load only hits the file system cache.
+ *
+ * @tparam dim An integer that denotes the dimension of the space in which
+ * the flow is solved
+ *
+ * @ingroup solvers
+ */
+template <int dim>
+class DEMSnapshotReader
+{
+public:
+  DEMSnapshotReader(
+    const std::string &                                dem_file_name,
+    const Parameters::Mesh &                           mesh_parameters,
+    const Parameters::Manifolds &                      manifolds_parameters,
+    const BoundaryConditions::BoundaryConditions<dim> &boundary_conditions,
+    const MPI_Comm &                                   mpi_communicator);
+
+  ~DEMSnapshotReader();
+
+  /**
+   * @brief Returns the checkpoint prefix of a snapshot of the series
+   *
+   * @param index Index of the snapshot within the time series
+   */
+  std::string
+  snapshot_prefix(const unsigned int index) const;
+
+  /**
+   * @brief Starts reading the files of a snapshot on a background thread.
+   * Only one snapshot can be prefetched at a time.
+   *
+   * @param index Index of the snapshot within the time series
+   */
+  void
+  prefetch(const unsigned int index);
+
+  /**
+   * @brief Loads the particles of a snapshot and inserts them in the
+   * particle handler of the fluid solver. This uses the prefetched files if
+   * the snapshot was prefetched and reads them otherwise. This is a
+   * collective operation.
+   *
+   * @param index Index of the snapshot within the time series
+   * @param triangulation The triangulation of the fluid solver
+   * @param particle_handler The particle handler in which the particles of
+   * the snapshot are inserted. Its previous particles are removed.
+   */
+  void
+  load(const unsigned int                               index,
+       const parallel::distributed::Triangulation<dim> &triangulation,
+       Particles::ParticleHandler<dim> &                particle_handler);
+
+private:
+  /**
+   * @brief Reads the files of a snapshot. The triangulation files are
+   * only read to bring them in the file system cache, whereas the
+   * serialized particle handler is returned.
+   *
+   * @param prefix Checkpoint prefix of the snapshot
+   */
+  std::string
+  read_snapshot_files(const std::string prefix) const;
+
+  const std::string dem_file_name;
+  MPI_Comm          mpi_communicator;
+
+  // Coarse mesh from which the triangulation of every snapshot is copied
+  std::shared_ptr<parallel::DistributedTriangulationBase<dim>>
+    coarse_triangulation;
+
+  // Serialized particle handler of the prefetched snapshot
+  std::future<std::string> prefetched_particles;
+  unsigned int             prefetched_index;
+};
+
+#endif
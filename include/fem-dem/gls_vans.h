@@ -35,6 +35,7 @@
 #include <core/parameters_cfd_dem.h>
 #include <dem/dem.h>
 #include <dem/dem_properties.h>
+#include <fem-dem/dem_snapshot_reader.h>
 
 #include "core/bdf.h"
 #include "core/grids.h"
@@ -79,6 +80,37 @@ private:
   void
   calculate_void_fraction(const double time);
 
+  /**
+   * @brief Loads the DEM snapshots that bracket the given time when a time
+   * series of DEM checkpoints is replayed and starts reading the following
+   * snapshot in the background
+   *
+   * @param time Time at which the void fraction is calculated
+   */
+  void
+  update_dem_snapshots(const double time);
+
+  /**
+   * @brief Calculates the void fraction of a single DEM snapshot by L2
+   * projection of the particles of the snapshot
+   *
+   * @param index Index of the snapshot within the time series
+   * @param snapshot_void_fraction Vector in which the void fraction is stored
+   */
+  void
+  calculate_snapshot_void_fraction(
+    const unsigned int             index,
+    TrilinosWrappers::MPI::Vector &snapshot_void_fraction);
+
+  /**
+   * @brief Linearly interpolates the void fraction in time between the two
+   * DEM snapshots that bracket the given time
+   *
+   * @param time Time at which the void fraction is calculated
+   */
+  void
+  interpolate_snapshots_void_fraction(const double time);
+
   void
   assemble_L2_projection_void_fraction();
 
@@ -162,6 +194,13 @@ private:
   std::shared_ptr<TrilinosWrappers::PreconditionILU> ilu_preconditioner;
   AffineConstraints<double>                          void_fraction_constraints;
 
+  // Time series of DEM snapshots. The void fraction is interpolated in time
+  // between the previous and the next snapshot.
+  std::shared_ptr<DEMSnapshotReader<dim>> dem_snapshot_reader;
+  unsigned int                            dem_snapshot_index;
+  TrilinosWrappers::MPI::Vector           void_fraction_snapshot_previous;
+  TrilinosWrappers::MPI::Vector           void_fraction_snapshot_next;
+
 
 
   const bool   PSPG        = true;
@@ -20,6 +20,8 @@
 #ifndef lethe_auxiliary_physics_h
 #define lethe_auxiliary_physics_h
 
+#include <deal.II/base/quadrature.h>
+
 #include <deal.II/distributed/tria_base.h>
 
 #include <deal.II/numerics/data_out.h>
@@ -65,10 +67,13 @@ public:
    * @brief AuxiliaryPhysics - Base constructor for Auxiliary physics. At the present
    * moment this is an interface with nothing. The auxiliary physics is a pure
    * virtual class.
+   *
+   * @param physics_name Name of the physics appended to the telemetry file
    */
   AuxiliaryPhysics(
-    const Parameters::NonLinearSolver non_linear_solver_parameters)
-    : PhysicsSolver<VectorType>(non_linear_solver_parameters)
+    const Parameters::NonLinearSolver non_linear_solver_parameters,
+    const std::string &               physics_name)
+    : PhysicsSolver<VectorType>(non_linear_solver_parameters, physics_name)
   {}
 
   /**
@@ -104,12 +109,26 @@ public:
   virtual void
   percolate_time_vectors() = 0;
 
+  /**
+   * @brief Replace the initial guess of the non-linear solver by the
+   * extrapolation of the solutions of the previous time steps when this is
+   * enabled
+   */
+  virtual void
+  extrapolate_initial_guess() = 0;
+
   /**
    * @brief Provide the dof handler associated with an auxiliary physics
    */
   virtual const DoFHandler<dim> &
   get_dof_handler() = 0;
 
+  /**
+   * @brief Provide the face quadrature associated with an auxiliary physics
+   */
+  virtual const Quadrature<dim - 1> &
+  get_face_quadrature() = 0;
+
   /**
    * @brief Postprocess the auxiliary physics results. Post-processing this case implies
    * the calculation of all derived quantities using the solution vector of the
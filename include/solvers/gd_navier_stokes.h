@@ -123,6 +123,9 @@ private:
   solve_linear_system(const bool initial_step,
                       const bool renewed_matrix) override;
 
+  virtual void
+  add_linear_system_memory_usage(MemoryReport &report) const override;
+
   /**
    * GMRES solver with ILU preconditioning
    */
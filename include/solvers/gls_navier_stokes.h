@@ -79,6 +79,9 @@ protected:
   solve_linear_system(const bool initial_step,
                       const bool renewed_matrix = true);
 
+  virtual void
+  add_linear_system_memory_usage(MemoryReport &report) const override;
+
 private:
   void
   assemble_L2_projection();
@@ -21,7 +21,10 @@
 #ifndef lethe_gls_nitsche_navier_stokes_h
 #define lethe_gls_nitsche_navier_stokes_h
 
+#include <deal.II/base/table.h>
+
 #include <deal.II/lac/trilinos_vector.h>
+#include <deal.II/lac/vector.h>
 
 #include <core/solid_base.h>
 
@@ -29,6 +32,28 @@
 
 using namespace dealii;
 
+/**
+ * @brief Values required by the Nitsche restriction at the solid particles
+ * located in a fluid cell. They are tabulated once per cell and shared by the
+ * assembly of the matrix and of the rhs and by the calculation of the forces
+ * and torques on the solid.
+ */
+template <int spacedim>
+struct NitscheCellValues
+{
+  // Values of the velocity shape functions of the fluid at every particle
+  // (rows) for every dof of the cell (columns). Pressure dofs are left at zero.
+  Table<2, double> shape_values;
+
+  // Location and weight of every particle
+  std::vector<Point<spacedim>> locations;
+  std::vector<double>          JxW;
+
+  // Velocity of the fluid and of the solid at every particle
+  std::vector<Tensor<1, spacedim>>    fluid_velocity;
+  std::vector<dealii::Vector<double>> solid_velocity;
+};
+
 /**
  * A solver class for the Navier-Stokes equation using GLS stabilization
  * and Nitsche immersed boundary method
@@ -57,6 +82,39 @@ private:
   void
   assemble_nitsche_restriction();
 
+  /**
+   * @brief Tabulates the shape functions, the fluid velocity and the solid
+   * velocity at all the solid particles located in a fluid cell at once
+   *
+   * @param pic The particles of the solid located in the cell
+   * @param fluid_dof_indices The dof indices of the fluid cell
+   * @param solid_velocity The velocity of the solid
+   * @param cell_values The values tabulated at the particles
+   */
+  void
+  tabulate_nitsche_cell_values(
+    const typename Particles::ParticleHandler<spacedim>::particle_iterator_range
+      &                                         pic,
+    const std::vector<types::global_dof_index> &fluid_dof_indices,
+    Function<spacedim> *                        solid_velocity,
+    NitscheCellValues<spacedim> &               cell_values);
+
+  /**
+   * @brief Weight of a fluid cell when the fluid triangulation is
+   * repartitioned during mesh adaptation. The assembly of the Nitsche
+   * restriction is carried out on the solid particles, cells are thus
+   * weighted according to the number of solid particles they contain.
+   *
+   * @param cell The fluid cell
+   * @param status The status of the cell in the refinement
+   */
+  unsigned int
+  cell_weight(
+    const typename parallel::distributed::Triangulation<spacedim>::cell_iterator
+      &cell,
+    const typename parallel::distributed::Triangulation<spacedim>::CellStatus
+      status) const;
+
   /**
    * @brief Calculates the force due to the fluid motion on the solid
    * @return Tensor of forces on the solid
@@ -135,6 +193,9 @@ private:
 
   std::vector<TableHandler> solid_forces_table;
   std::vector<TableHandler> solid_torques_table;
+
+  // Local dofs of the fluid element associated with each velocity component
+  std::vector<std::vector<unsigned int>> velocity_component_dofs;
 };
 
 
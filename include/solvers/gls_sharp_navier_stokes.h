@@ -103,6 +103,17 @@ private:
   void
   refine_ib();
 
+  // Weight of a cell when the triangulation is repartitioned during mesh
+  // adaptation. Cells cut by a particle carry the extra cost of the sharp
+  // edge stencils and are weighted according to the number of particles
+  // cutting them.
+  unsigned int
+  cell_weight(
+    const typename parallel::distributed::Triangulation<dim>::cell_iterator
+      &cell,
+    const typename parallel::distributed::Triangulation<dim>::CellStatus
+      status) const;
+
   // Modified version of assemble_matrix_and_rhs to include the presence of
   // extra steps.
   void
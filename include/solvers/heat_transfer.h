@@ -57,16 +57,14 @@ public:
                                                        p_triangulation,
                     std::shared_ptr<SimulationControl> p_simulation_control)
     : AuxiliaryPhysics<dim, TrilinosWrappers::MPI::Vector>(
-        p_simulation_parameters.non_linear_solver)
+        p_simulation_parameters.non_linear_solver,
+        "heat_transfer")
     , multiphysics(multiphysics_interface)
     , simulation_parameters(p_simulation_parameters)
     , triangulation(p_triangulation)
     , simulation_control(p_simulation_control)
     , dof_handler(*triangulation)
     , solution_transfer(dof_handler)
-    , solution_transfer_m1(dof_handler)
-    , solution_transfer_m2(dof_handler)
-    , solution_transfer_m3(dof_handler)
   {
 #ifdef DEAL_II_WITH_SIMPLEX_SUPPORT
     if (simulation_parameters.mesh.simplex)
@@ -147,6 +145,13 @@ public:
   virtual void
   percolate_time_vectors() override;
 
+  /**
+   * @brief Extrapolates the initial guess of the non-linear solver from the
+   * solutions of the previous time steps
+   */
+  virtual void
+  extrapolate_initial_guess() override;
+
   /**
    * @brief Postprocess the auxiliary physics results. Post-processing this case implies
    * the calculation of all derived quantities using the solution vector of the
@@ -193,6 +198,15 @@ public:
     return dof_handler;
   };
 
+  /**
+   * @brief Returns the face quadrature of the heat transfer physics
+   */
+  virtual const Quadrature<dim - 1> &
+  get_face_quadrature() override
+  {
+    return *face_quadrature;
+  };
+
   /**
    * @brief Sets-up the DofHandler and the degree of freedom associated with the physics.
    */
@@ -299,16 +313,12 @@ private:
   TrilinosWrappers::MPI::Vector solution_m1;
   TrilinosWrappers::MPI::Vector solution_m2;
   TrilinosWrappers::MPI::Vector solution_m3;
+  TrilinosWrappers::MPI::Vector solution_m4;
 
-  // Solution transfer classes
+  // Solution transfer class, which transfers the present and the past
+  // solutions together
   parallel::distributed::SolutionTransfer<dim, TrilinosWrappers::MPI::Vector>
     solution_transfer;
-  parallel::distributed::SolutionTransfer<dim, TrilinosWrappers::MPI::Vector>
-    solution_transfer_m1;
-  parallel::distributed::SolutionTransfer<dim, TrilinosWrappers::MPI::Vector>
-    solution_transfer_m2;
-  parallel::distributed::SolutionTransfer<dim, TrilinosWrappers::MPI::Vector>
-    solution_transfer_m3;
 
   // Reference for GGLS https://onlinelibrary.wiley.com/doi/abs/10.1002/nme.2324
   // Warning, this GGLS implementation is valid only for Linear elements
@@ -81,10 +81,12 @@ public:
     // sequentially.
     for (auto &iphys : physics)
       {
+        iphys.second->extrapolate_initial_guess();
         solve_physics(iphys.first, time_stepping_method, force_matrix_renewal);
       }
     for (auto &iphys : block_physics)
       {
+        iphys.second->extrapolate_initial_guess();
         solve_block_physics(iphys.first,
                             time_stepping_method,
                             force_matrix_renewal);
@@ -348,6 +350,19 @@ public:
     return physics_dof_handler[physics_id];
   }
 
+  /**
+   * @brief Request the face quadrature of a given auxiliary physics
+   *
+   * @param physics_id The physics of the face quadrature being requested
+   */
+  const Quadrature<dim - 1> &
+  get_face_quadrature(PhysicsID physics_id)
+  {
+    AssertThrow(physics.find(physics_id) != physics.end(),
+                ExcInternalError());
+    return physics[physics_id]->get_face_quadrature();
+  }
+
 
 
   /**
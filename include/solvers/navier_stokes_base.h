@@ -98,11 +98,13 @@
 #include <core/bdf.h>
 #include <core/boundary_conditions.h>
 #include <core/manifolds.h>
+#include <core/memory_report.h>
 #include <core/newton_non_linear_solver.h>
 #include <core/parameters.h>
 #include <core/physics_solver.h>
 #include <core/pvd_handler.h>
 #include <core/simulation_control.h>
+#include <core/solutions_output.h>
 #include <solvers/flow_control.h>
 #include <solvers/multiphysics_interface.h>
 #include <solvers/postprocessing_cfd.h>
@@ -248,6 +250,10 @@ protected:
   {
     setup_dofs_fd();
     multiphysics->setup_dofs();
+
+    // The preconditioners are only built by the next linear solve, the
+    // memory report is printed once they are
+    memory_report_pending = this->simulation_parameters.timer.memory_report;
   };
 
   /**
@@ -319,6 +325,35 @@ protected:
   virtual void
   setup_dofs_fd() = 0;
 
+  /**
+   * @brief print_memory_usage
+   *
+   * Print the minimum and maximum memory used by the processes for the
+   * triangulation, the dofs, the linear system and the solution vectors of
+   * the fluid dynamics
+   */
+  void
+  print_memory_usage();
+
+  /**
+   * @brief print_pending_memory_usage
+   *
+   * Print the memory usage if it was requested by the last setup of the dofs.
+   * This is called at the end of the linear solve of the fluid dynamics, so
+   * that the report includes the preconditioners built for the new dofs.
+   */
+  void
+  print_pending_memory_usage();
+
+  /**
+   * @brief add_linear_system_memory_usage
+   *
+   * Add the memory used by the system matrix and by the preconditioners of
+   * the fluid dynamics to a memory report
+   */
+  virtual void
+  add_linear_system_memory_usage(MemoryReport &report) const = 0;
+
   virtual void
   set_initial_condition_fd(
     Parameters::InitialConditionType initial_condition_type,
@@ -371,6 +406,27 @@ protected:
   virtual void
   iterate();
 
+  /**
+   * @brief extrapolate_initial_guess
+   * Replace the present solution, which is the initial guess of the
+   * non-linear solver, by its extrapolation from the solutions of the previous
+   * time steps when this is enabled and enough previous solutions are
+   * available
+   */
+  void
+  extrapolate_initial_guess();
+
+  /**
+   * @brief relative_velocity_extrapolation_difference
+   * Calculate the relative difference between the velocity of the present
+   * solution and its extrapolation from the solutions of the previous time
+   * steps. The pressure is not integrated in time by the BDF schemes, it is
+   * thus excluded from the estimate of their local truncation error.
+   *
+   * @param n_points Number of previous solutions used in the extrapolation
+   */
+  double
+  relative_velocity_extrapolation_difference(const unsigned int n_points);
 
   /**
    * @brief First iteration
@@ -385,6 +441,22 @@ protected:
   void
   refine_mesh_kelly();
 
+  /**
+   * @brief Calculates the refinement indicator of each active cell for a
+   * variable of the mesh adaptation. The Kelly estimator is used for the
+   * velocity, the pressure, the temperature and the tracer, whereas the
+   * vorticity and the Q-criterion indicators are the L2 norm over the cell
+   * of the magnitude of the vorticity or of the square root of the positive
+   * part of the Q-criterion, scaled by the cell diameter.
+   *
+   * @param variable Variable on which the indicator is calculated
+   * @param indicator Indicator of each active cell of the triangulation
+   */
+  void
+  estimate_refinement_indicator(
+    const Parameters::MeshAdaptation::Variable variable,
+    Vector<float> &                            indicator);
+
   void
   refine_mesh_uniform();
 
@@ -449,6 +521,15 @@ protected:
   SimulationParameters<dim> simulation_parameters;
   PVDHandler                pvdhandler;
 
+  // Indicates that the memory usage is printed after the next linear solve
+  bool memory_report_pending;
+
+  // Writer used when the results are written on a background thread
+  AsynchronousVTUWriter<dim> asynchronous_vtu_writer;
+
+  // Entries of the xdmf file when the results are written in hdf5 format
+  std::vector<XDMFEntry> xdmf_entries;
+
   Function<dim> *exact_solution;
   Function<dim> *forcing_function;
 
@@ -474,6 +555,7 @@ protected:
   VectorType solution_m1;
   VectorType solution_m2;
   VectorType solution_m3;
+  VectorType solution_m4;
 
   // Finite element order used
   const unsigned int velocity_fem_degree;
@@ -39,6 +39,7 @@ namespace Parameters
   public:
     NitscheSolid()
       : solid_velocity(dim)
+      , solid_velocity_type(SolidVelocityType::function)
     {}
 
     void
@@ -53,6 +54,19 @@ namespace Parameters
     Functions::ParsedFunction<dim> solid_velocity;
     bool                           enable_particles_motion;
 
+    // Solid velocity given by a parsed function or by the kinematics of a
+    // rigid body
+    enum class SolidVelocityType
+    {
+      function,
+      rigid_body
+    } solid_velocity_type;
+
+    // Rigid body kinematics. The angular velocity is always a 3D tensor and
+    // the rotation takes place around the center of rotation.
+    Tensor<1, dim> translational_velocity;
+    Tensor<1, 3>   angular_velocity;
+
     // Particle motion integration parameters
     unsigned int particles_sub_iterations;
 
@@ -76,6 +90,25 @@ namespace Parameters
       if (dim == 3)
         prm.set("Function expression", "0; 0; 0");
       prm.leave_subsection();
+      prm.declare_entry(
+        "solid velocity type",
+        "function",
+        Patterns::Selection("function|rigid body"),
+        "Velocity of the solid given by the solid velocity function or by "
+        "the translational and angular velocities of a rigid body rotating "
+        "around the center of rotation. The rigid body velocity is evaluated "
+        "without parsing an expression. "
+        "Choices are <function|rigid body>.");
+      prm.enter_subsection("translational velocity");
+      prm.declare_entry("x", "0", Patterns::Double(), "X velocity");
+      prm.declare_entry("y", "0", Patterns::Double(), "Y velocity");
+      prm.declare_entry("z", "0", Patterns::Double(), "Z velocity");
+      prm.leave_subsection();
+      prm.enter_subsection("angular velocity");
+      prm.declare_entry("x", "0", Patterns::Double(), "X angular velocity");
+      prm.declare_entry("y", "0", Patterns::Double(), "Y angular velocity");
+      prm.declare_entry("z", "0", Patterns::Double(), "Z angular velocity");
+      prm.leave_subsection();
       prm.declare_entry("enable particles motion",
                         "false",
                         Patterns::Bool(),
@@ -107,6 +140,27 @@ namespace Parameters
       prm.enter_subsection("solid velocity");
       solid_velocity.parse_parameters(prm);
       prm.leave_subsection();
+      const std::string velocity_type = prm.get("solid velocity type");
+      if (velocity_type == "function")
+        solid_velocity_type = SolidVelocityType::function;
+      else if (velocity_type == "rigid body")
+        solid_velocity_type = SolidVelocityType::rigid_body;
+      else
+        throw std::logic_error("Error, invalid solid velocity type");
+
+      prm.enter_subsection("translational velocity");
+      translational_velocity[0] = prm.get_double("x");
+      translational_velocity[1] = prm.get_double("y");
+      if (dim == 3)
+        translational_velocity[2] = prm.get_double("z");
+      prm.leave_subsection();
+
+      prm.enter_subsection("angular velocity");
+      angular_velocity[0] = prm.get_double("x");
+      angular_velocity[1] = prm.get_double("y");
+      angular_velocity[2] = prm.get_double("z");
+      prm.leave_subsection();
+
       enable_particles_motion  = prm.get_bool("enable particles motion");
       particles_sub_iterations = prm.get_integer("particles sub iterations");
 
@@ -143,6 +197,11 @@ namespace Parameters
     std::string force_output_name;
     std::string torque_output_name;
 
+    // Additional weight of each solid particle located in a fluid cell when
+    // the fluid triangulation is repartitioned. The repartitioning is not
+    // weighted if it is zero.
+    unsigned int particle_weight;
+
     // Nitsche solid objects
     std::vector<std::shared_ptr<NitscheSolid<dim>>> nitsche_solids;
     unsigned int                                    number_solids;
@@ -185,6 +244,15 @@ namespace Parameters
                         Patterns::FileName(),
                         "File output solid torque prefix");
 
+      prm.declare_entry(
+        "particle weight",
+        "0",
+        Patterns::Integer(),
+        "Additional weight of each solid particle located in a fluid cell "
+        "when the fluid triangulation is repartitioned during mesh "
+        "adaptation, every cell having a weight of 1000. The "
+        "repartitioning is not weighted if it is 0.");
+
       prm.declare_entry("number of solids",
                         "1",
                         Patterns::Integer(),
@@ -215,6 +283,7 @@ namespace Parameters
       calculate_torque_on_solid = prm.get_bool("calculate torques on solid");
       force_output_name         = prm.get("solid force name");
       torque_output_name        = prm.get("solid torque name");
+      particle_weight           = prm.get_integer("particle weight");
 
       number_solids = prm.get_integer("number of solids");
       for (unsigned int i_solid = 0; i_solid < number_solids; ++i_solid)
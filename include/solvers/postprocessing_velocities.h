@@ -153,15 +153,18 @@ public:
 
 
   /**
-   * @brief Prepares average velocity object for dynamic mesh adaptation
+   * @brief Prepares average velocity object for dynamic mesh adaptation.
+   * The returned vectors are transferred to the new mesh by the solution
+   * transfer of the fluid dynamics, along with the solution vectors.
    */
-  void
+  std::vector<const VectorType *>
   prepare_for_mesh_adaptation();
 
   /**
-   * @brief Re-establish solution vectors after dynamic mesh adaptation
+   * @brief Returns the vectors in which the solution transfer of the fluid
+   * dynamics interpolates the sum vectors after dynamic mesh adaptation.
    */
-  void
+  std::vector<VectorType *>
   post_mesh_adaptation();
 
   /**
@@ -174,6 +177,13 @@ public:
   std::vector<VectorType *>
   read(std::string prefix);
 
+  /**
+   * @brief Returns the memory used by the vectors of the average velocities
+   * and of the Reynolds stresses
+   */
+  std::size_t
+  memory_consumption() const;
+
 private:
   TrilinosScalar inv_range_time;
   TrilinosScalar dt_0;
@@ -197,14 +207,6 @@ private:
   VectorType sum_rns_dt_with_ghost_cells;
   VectorType sum_rss_dt_with_ghost_cells;
 
-  // Solution transfer for the three permanent velocity storage
-  parallel::distributed::SolutionTransfer<dim, VectorType>
-    solution_transfer_sum_velocity_dt;
-  parallel::distributed::SolutionTransfer<dim, VectorType>
-    solution_transfer_sum_reynolds_normal_stress_dt;
-  parallel::distributed::SolutionTransfer<dim, VectorType>
-    solution_transfer_sum_reynolds_shear_stress_dt;
-
   double       dt;
   double       real_initial_time;
   bool         average_calculation;
@@ -54,16 +54,14 @@ public:
                                                  p_triangulation,
               std::shared_ptr<SimulationControl> p_simulation_control)
     : AuxiliaryPhysics<dim, TrilinosWrappers::MPI::Vector>(
-        p_simulation_parameters.non_linear_solver)
+        p_simulation_parameters.non_linear_solver,
+        "tracer")
     , multiphysics(multiphysics_interface)
     , simulation_parameters(p_simulation_parameters)
     , triangulation(p_triangulation)
     , simulation_control(p_simulation_control)
     , dof_handler(*triangulation)
     , solution_transfer(dof_handler)
-    , solution_transfer_m1(dof_handler)
-    , solution_transfer_m2(dof_handler)
-    , solution_transfer_m3(dof_handler)
   {
 #ifdef DEAL_II_WITH_SIMPLEX_SUPPORT
     if (simulation_parameters.mesh.simplex)
@@ -73,6 +71,8 @@ public:
           simulation_parameters.fem_parameters.tracer_order);
         mapping         = std::make_shared<MappingFE<dim>>(*fe);
         cell_quadrature = std::make_shared<QGaussSimplex<dim>>(fe->degree + 1);
+        face_quadrature =
+          std::make_shared<QGaussSimplex<dim - 1>>(fe->degree + 1);
       }
     else
 #endif
@@ -83,6 +83,7 @@ public:
         mapping = std::make_shared<MappingQ<dim>>(
           fe->degree, simulation_parameters.fem_parameters.qmapping_all);
         cell_quadrature = std::make_shared<QGauss<dim>>(fe->degree + 1);
+        face_quadrature = std::make_shared<QGauss<dim - 1>>(fe->degree + 1);
       }
   }
 
@@ -139,6 +140,13 @@ public:
   virtual void
   percolate_time_vectors() override;
 
+  /**
+   * @brief Extrapolates the initial guess of the non-linear solver from the
+   * solutions of the previous time steps
+   */
+  virtual void
+  extrapolate_initial_guess() override;
+
   /**
    * @brief Postprocess the auxiliary physics results. Post-processing this case implies
    * the calculation of all derived quantities using the solution vector of the
@@ -185,6 +193,15 @@ public:
     return dof_handler;
   };
 
+  /**
+   * @brief Returns the face quadrature of the tracer physics
+   */
+  virtual const Quadrature<dim - 1> &
+  get_face_quadrature() override
+  {
+    return *face_quadrature;
+  };
+
   /**
    * @brief Sets-up the DofHandler and the degree of freedom associated with the physics.
    */
@@ -284,7 +301,8 @@ private:
   std::shared_ptr<FiniteElement<dim>> fe;
   // Mapping and Quadrature
   std::shared_ptr<Mapping<dim>>    mapping;
-  std::shared_ptr<Quadrature<dim>> cell_quadrature;
+  std::shared_ptr<Quadrature<dim>>     cell_quadrature;
+  std::shared_ptr<Quadrature<dim - 1>> face_quadrature;
 
 
   ConvergenceTable error_table;
@@ -307,16 +325,12 @@ private:
   TrilinosWrappers::MPI::Vector solution_m1;
   TrilinosWrappers::MPI::Vector solution_m2;
   TrilinosWrappers::MPI::Vector solution_m3;
+  TrilinosWrappers::MPI::Vector solution_m4;
 
-  // Solution transfer classes
+  // Solution transfer class, which transfers the present and the past
+  // solutions together
   parallel::distributed::SolutionTransfer<dim, TrilinosWrappers::MPI::Vector>
     solution_transfer;
-  parallel::distributed::SolutionTransfer<dim, TrilinosWrappers::MPI::Vector>
-    solution_transfer_m1;
-  parallel::distributed::SolutionTransfer<dim, TrilinosWrappers::MPI::Vector>
-    solution_transfer_m2;
-  parallel::distributed::SolutionTransfer<dim, TrilinosWrappers::MPI::Vector>
-    solution_transfer_m3;
 
   // Tracer statistics table
   TableHandler statistics_table;
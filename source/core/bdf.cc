@@ -73,3 +73,31 @@ bdf_coefficients(unsigned int p, const std::vector<double> dt)
     }
   return alpha;
 }
+
+Vector<double>
+extrapolation_coefficients(unsigned int n_points, const std::vector<double> dt)
+{
+  // There should be at least n_points time steps
+  assert(dt.size() >= n_points);
+
+  // Times of the previous solutions relative to the present time
+  Vector<double> times(n_points);
+  double         time = 0.;
+  for (unsigned int i = 0; i < n_points; ++i)
+    {
+      time -= dt[i];
+      times[i] = time;
+    }
+
+  // The coefficients are the Lagrange polynomials evaluated at the present
+  // time
+  Vector<double> coefficients(n_points);
+  for (unsigned int i = 0; i < n_points; ++i)
+    {
+      coefficients[i] = 1.;
+      for (unsigned int j = 0; j < n_points; ++j)
+        if (j != i)
+          coefficients[i] *= -times[j] / (times[i] - times[j]);
+    }
+  return coefficients;
+}
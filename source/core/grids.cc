@@ -1,6 +1,14 @@
 // Deal.II includes
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
+
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/vector.hpp>
 
 // Lethe includes
 #include "core/boundary_conditions.h"
@@ -8,8 +16,323 @@
 #include "core/periodic_hills_grid.h"
 
 // Std
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <sstream>
+
+
+/**
+ * @brief Returns true if the cache file exists and is more recent than the
+ * GMSH file it was generated from
+ */
+bool
+is_mesh_cache_valid(const std::string &cache_file_name,
+                    const std::string &mesh_file_name)
+{
+  std::error_code error;
+  const auto      cache_time =
+    std::filesystem::last_write_time(cache_file_name, error);
+  if (error)
+    return false;
+
+  const auto mesh_time =
+    std::filesystem::last_write_time(mesh_file_name, error);
+  return !error && cache_time >= mesh_time;
+}
+
+/**
+ * @brief Broadcasts a string from the root process to all processes. The
+ * string is sent in chunks since the count of an MPI message is an int,
+ * which limits its size to 2 GB.
+ */
+void
+broadcast_string(std::string &data, const MPI_Comm &communicator)
+{
+  unsigned long long int size = data.size();
+  int ierr = MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG_LONG, 0, communicator);
+  AssertThrowMPI(ierr);
+
+  data.resize(size);
+  const unsigned long long int max_chunk_size =
+    std::numeric_limits<int>::max();
+  for (unsigned long long int offset = 0; offset < size;
+       offset += max_chunk_size)
+    {
+      const int chunk_size =
+        static_cast<int>(std::min(max_chunk_size, size - offset));
+      ierr = MPI_Bcast(&data[offset], chunk_size, MPI_CHAR, 0, communicator);
+      AssertThrowMPI(ierr);
+    }
+}
+
+/**
+ * @brief Serializes the coarse cells of a triangulation, the boundary and
+ * manifold ids of its boundary faces and, in 3D, of its boundary lines. Each
+ * cell or face is stored as its vertex indices followed by its material or
+ * boundary id and by its manifold id.
+ */
+template <int dim, int spacedim>
+std::string
+serialize_coarse_grid(const Triangulation<dim, spacedim> &triangulation)
+{
+  const std::vector<Point<spacedim>> &vertices = triangulation.get_vertices();
+  std::vector<unsigned int>           cells;
+  std::vector<unsigned int>           faces;
+  std::vector<unsigned int>           lines;
+
+  std::vector<bool> line_visited(triangulation.n_lines(), false);
+  for (const auto &cell : triangulation.cell_iterators_on_level(0))
+    {
+      for (unsigned int v = 0; v < GeometryInfo<dim>::vertices_per_cell; ++v)
+        cells.push_back(cell->vertex_index(v));
+      cells.push_back(cell->material_id());
+      cells.push_back(cell->manifold_id());
+
+      for (unsigned int f = 0; f < GeometryInfo<dim>::faces_per_cell; ++f)
+        {
+          const auto face = cell->face(f);
+          if (!face->at_boundary())
+            continue;
+
+          for (unsigned int v = 0;
+               v < GeometryInfo<dim - 1>::vertices_per_cell;
+               ++v)
+            faces.push_back(face->vertex_index(v));
+          faces.push_back(face->boundary_id());
+          faces.push_back(face->manifold_id());
+
+          if constexpr (dim == 3)
+            for (unsigned int l = 0; l < GeometryInfo<dim - 1>::lines_per_cell;
+                 ++l)
+              {
+                const auto line = face->line(l);
+                if (line_visited[line->index()])
+                  continue;
+                line_visited[line->index()] = true;
+
+                lines.push_back(line->vertex_index(0));
+                lines.push_back(line->vertex_index(1));
+                lines.push_back(line->boundary_id());
+                lines.push_back(line->manifold_id());
+              }
+        }
+    }
+
+  std::ostringstream              oss;
+  boost::archive::binary_oarchive oa(oss);
+  oa << vertices << cells << faces << lines;
+  return oss.str();
+}
+
+/**
+ * @brief Creates the coarse grid of a triangulation from the output of
+ * serialize_coarse_grid
+ */
+template <int dim, int spacedim>
+void
+create_coarse_grid_from_serialization(
+  const std::string &           serialized_grid,
+  Triangulation<dim, spacedim> &triangulation)
+{
+  std::vector<Point<spacedim>> vertices;
+  std::vector<unsigned int>    cells;
+  std::vector<unsigned int>    faces;
+  std::vector<unsigned int>    lines;
+  {
+    std::istringstream              iss(serialized_grid);
+    boost::archive::binary_iarchive ia(iss);
+    ia >> vertices >> cells >> faces >> lines;
+  }
+
+  const unsigned int cell_stride = GeometryInfo<dim>::vertices_per_cell + 2;
+  std::vector<CellData<dim>> cell_data(cells.size() / cell_stride);
+  for (unsigned int c = 0; c < cell_data.size(); ++c)
+    {
+      const unsigned int *data = &cells[c * cell_stride];
+      for (unsigned int v = 0; v < GeometryInfo<dim>::vertices_per_cell; ++v)
+        cell_data[c].vertices[v] = data[v];
+      cell_data[c].material_id = data[cell_stride - 2];
+      cell_data[c].manifold_id = data[cell_stride - 1];
+    }
+
+  SubCellData        subcell_data;
+  const unsigned int face_stride = GeometryInfo<dim - 1>::vertices_per_cell + 2;
+  for (unsigned int f = 0; f < faces.size(); f += face_stride)
+    {
+      if constexpr (dim == 2)
+        {
+          CellData<1> face_data;
+          face_data.vertices[0] = faces[f];
+          face_data.vertices[1] = faces[f + 1];
+          face_data.boundary_id = faces[f + 2];
+          face_data.manifold_id = faces[f + 3];
+          subcell_data.boundary_lines.push_back(face_data);
+        }
+      else
+        {
+          CellData<2> face_data;
+          for (unsigned int v = 0; v < 4; ++v)
+            face_data.vertices[v] = faces[f + v];
+          face_data.boundary_id = faces[f + 4];
+          face_data.manifold_id = faces[f + 5];
+          subcell_data.boundary_quads.push_back(face_data);
+        }
+    }
+
+  for (unsigned int l = 0; l < lines.size(); l += 4)
+    {
+      CellData<1> line_data;
+      line_data.vertices[0] = lines[l];
+      line_data.vertices[1] = lines[l + 1];
+      line_data.boundary_id = lines[l + 2];
+      line_data.manifold_id = lines[l + 3];
+      subcell_data.boundary_lines.push_back(line_data);
+    }
+
+  triangulation.create_triangulation(vertices, cell_data, subcell_data);
+}
+
+template <int dim, int spacedim>
+void
+read_gmsh_coarse_grid(Triangulation<dim, spacedim> &triangulation,
+                      const Parameters::Mesh &      mesh_parameters,
+                      const MPI_Comm &              communicator)
+{
+  const std::string cache_file_name = mesh_parameters.file_name + ".cache";
+
+  // Only the root process reads the mesh, either from the binary cache or
+  // from the GMSH file. The coarse grid is then sent to the other processes
+  // in a serialized form, which is much cheaper to load than to parse the
+  // GMSH file on every process. An error on the root process is sent to the
+  // other processes, which would otherwise wait for the grid forever, so that
+  // all of them throw.
+  std::string serialized_grid;
+  std::string error_message;
+  if (Utilities::MPI::this_mpi_process(communicator) == 0)
+    try
+      {
+        if (mesh_parameters.cache &&
+            is_mesh_cache_valid(cache_file_name, mesh_parameters.file_name))
+          {
+            std::ifstream      input(cache_file_name, std::ios::binary);
+            std::ostringstream buffer;
+            buffer << input.rdbuf();
+            serialized_grid = buffer.str();
+          }
+        else
+          {
+            Triangulation<dim, spacedim> serial_triangulation;
+            GridIn<dim, spacedim>        grid_in;
+            grid_in.attach_triangulation(serial_triangulation);
+            std::ifstream input_file(mesh_parameters.file_name);
+            AssertThrow(input_file, ExcFileNotOpen(mesh_parameters.file_name));
+            grid_in.read_msh(input_file);
+
+            serialized_grid = serialize_coarse_grid(serial_triangulation);
+
+            if (mesh_parameters.cache)
+              {
+                std::ofstream output(cache_file_name, std::ios::binary);
+                output.write(serialized_grid.data(), serialized_grid.size());
+              }
+          }
+      }
+    catch (const std::exception &exc)
+      {
+        error_message = exc.what();
+      }
+
+  broadcast_string(error_message, communicator);
+  AssertThrow(error_message.empty(), ExcMessage(error_message));
+
+  broadcast_string(serialized_grid, communicator);
+  create_coarse_grid_from_serialization(serialized_grid, triangulation);
+}
+
+#ifdef DEAL_II_WITH_SIMPLEX_SUPPORT
+/**
+ * @brief Reads a simplex GMSH mesh on one process per group of processes and
+ * creates the fully distributed triangulation from the partitioned mesh. When
+ * the cache is enabled, the description of the locally owned part of the mesh
+ * is stored in one file per process and these files are read directly in
+ * subsequent runs with the same number of processes.
+ */
+template <int dim, int spacedim>
+void
+read_simplex_gmsh_grid(
+  std::shared_ptr<parallel::DistributedTriangulationBase<dim, spacedim>>
+                          triangulation,
+  const Parameters::Mesh &mesh_parameters)
+{
+  const MPI_Comm     communicator = triangulation->get_communicator();
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(communicator);
+  const unsigned int this_process =
+    Utilities::MPI::this_mpi_process(communicator);
+
+  // The cache is pre-partitioned, it is thus specific to the number of
+  // processes
+  const std::string cache_file_name =
+    mesh_parameters.file_name + ".cache." +
+    Utilities::int_to_string(n_procs) + "." +
+    Utilities::int_to_string(this_process,
+                             Utilities::needed_digits(n_procs - 1));
+
+  const bool use_cache =
+    mesh_parameters.cache &&
+    Utilities::MPI::min(
+      is_mesh_cache_valid(cache_file_name, mesh_parameters.file_name) ? 1 : 0,
+      communicator) == 1;
+
+  TriangulationDescription::Description<dim, spacedim> construction_data;
+  if (use_cache)
+    {
+      std::ifstream                   input(cache_file_name, std::ios::binary);
+      boost::archive::binary_iarchive ia(input);
+      ia >> construction_data;
+      construction_data.comm = communicator;
+    }
+  else
+    {
+      const unsigned int group_size = mesh_parameters.reader_group_size == 0 ?
+                                        n_procs :
+                                        mesh_parameters.reader_group_size;
+
+      construction_data = TriangulationDescription::Utilities::
+        create_description_from_triangulation_in_groups<dim, spacedim>(
+          [&](Triangulation<dim, spacedim> &basetria) {
+            GridIn<dim, spacedim> grid_in;
+            grid_in.attach_triangulation(basetria);
+            std::ifstream input_file(mesh_parameters.file_name);
+            AssertThrow(input_file,
+                        ExcFileNotOpen(mesh_parameters.file_name));
+            grid_in.read_msh(input_file);
+          },
+          [](Triangulation<dim, spacedim> &basetria,
+             const MPI_Comm &              comm,
+             const unsigned int /*group_size*/) {
+            GridTools::partition_triangulation_zorder(
+              Utilities::MPI::n_mpi_processes(comm), basetria);
+            GridTools::partition_multigrid_levels(basetria);
+          },
+          communicator,
+          group_size,
+          Triangulation<dim, spacedim>::limit_level_difference_at_vertices,
+          TriangulationDescription::Settings::construct_multigrid_hierarchy);
+
+      if (mesh_parameters.cache)
+        {
+          std::ofstream output(cache_file_name, std::ios::binary);
+          boost::archive::binary_oarchive oa(output);
+          oa << construction_data;
+        }
+    }
+
+  triangulation->create_triangulation(construction_data);
+}
+#endif
 
 
 template <int dim, int spacedim>
@@ -25,10 +348,9 @@ attach_grid_to_triangulation(
   if (mesh_parameters.type == Parameters::Mesh::Type::gmsh &&
       !mesh_parameters.simplex)
     {
-      GridIn<dim, spacedim> grid_in;
-      grid_in.attach_triangulation(*triangulation);
-      std::ifstream input_file(mesh_parameters.file_name);
-      grid_in.read_msh(input_file);
+      read_gmsh_coarse_grid(*triangulation,
+                            mesh_parameters,
+                            triangulation->get_communicator());
     }
   // Dealii grids
   else if (mesh_parameters.type == Parameters::Mesh::Type::dealii &&
@@ -44,32 +366,7 @@ attach_grid_to_triangulation(
   else if (mesh_parameters.type == Parameters::Mesh::Type::gmsh &&
            mesh_parameters.simplex)
     {
-      // TODO - Serial triangulation should only be created on one processor...
-      // Get communicator from triangulation
-      // auto communicator     = triangulation->get_communicator();
-      // auto this_mpi_process = Utilities::MPI::this_mpi_process(communicator);
-
-      Triangulation<dim, spacedim> basetria(
-        Triangulation<dim, spacedim>::limit_level_difference_at_vertices);
-
-
-      GridIn<dim, spacedim> grid_in;
-      grid_in.attach_triangulation(basetria);
-      std::ifstream input_file(mesh_parameters.file_name);
-
-      grid_in.read_msh(input_file);
-      GridTools::partition_triangulation_zorder(
-        Utilities::MPI::n_mpi_processes(triangulation->get_communicator()),
-        basetria);
-      GridTools::partition_multigrid_levels(basetria);
-
-      // create parallel::fullydistributed::Triangulation from description
-      auto construction_data = TriangulationDescription::Utilities::
-        create_description_from_triangulation(
-          basetria,
-          triangulation->get_communicator(),
-          TriangulationDescription::Settings::construct_multigrid_hierarchy);
-      triangulation->create_triangulation(construction_data);
+      read_simplex_gmsh_grid(triangulation, mesh_parameters);
     }
   // Dealii grids
   else if (mesh_parameters.type == Parameters::Mesh::Type::dealii &&
@@ -173,6 +470,19 @@ read_mesh_and_manifolds(
     }
 }
 
+template void
+read_gmsh_coarse_grid(Triangulation<2> &      triangulation,
+                      const Parameters::Mesh &mesh_parameters,
+                      const MPI_Comm &        communicator);
+template void
+read_gmsh_coarse_grid(Triangulation<3> &      triangulation,
+                      const Parameters::Mesh &mesh_parameters,
+                      const MPI_Comm &        communicator);
+template void
+read_gmsh_coarse_grid(Triangulation<2, 3> &   triangulation,
+                      const Parameters::Mesh &mesh_parameters,
+                      const MPI_Comm &        communicator);
+
 template void attach_grid_to_triangulation(
   std::shared_ptr<parallel::DistributedTriangulationBase<2>> triangulation,
   const Parameters::Mesh &                                   mesh_parameters,
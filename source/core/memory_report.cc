@@ -0,0 +1,80 @@
+#include "core/memory_report.h"
+
+#include <deal.II/base/utilities.h>
+
+#include <Ifpack_AdditiveSchwarz.h>
+#include <Ifpack_ILU.h>
+
+#include <iomanip>
+#include <sstream>
+
+void
+MemoryReport::add_entry(const std::string &label, const std::size_t bytes)
+{
+  entries.emplace_back(label, bytes);
+}
+
+void
+MemoryReport::print(const ConditionalOStream &pcout,
+                    const MPI_Comm &          mpi_communicator,
+                    const std::string &       title) const
+{
+  const double megabyte = 1024. * 1024.;
+
+  std::ostringstream report;
+  report << std::fixed << std::setprecision(2);
+  report << "Memory usage " << title << " (MB)" << std::endl;
+  report << "  " << std::setw(28) << std::left << "Data structure"
+         << std::setw(12) << std::right << "Minimum" << std::setw(12)
+         << "Maximum" << std::endl;
+
+  const auto print_entry = [&](const std::string &label, const double bytes) {
+    const auto statistics =
+      Utilities::MPI::min_max_avg(bytes / megabyte, mpi_communicator);
+    report << "  " << std::setw(28) << std::left << label << std::setw(12)
+           << std::right << statistics.min << std::setw(12) << statistics.max
+           << std::endl;
+  };
+
+  double total = 0;
+  for (const auto &entry : entries)
+    {
+      print_entry(entry.first, entry.second);
+      total += entry.second;
+    }
+  print_entry("Total of the above", total);
+
+  // The resident memory is reported by the operating system in kB
+  Utilities::System::MemoryStats memory_stats;
+  Utilities::System::get_memory_stats(memory_stats);
+  print_entry("Process resident memory", 1024. * memory_stats.VmRSS);
+
+  pcout << report.str();
+}
+
+std::size_t
+ilu_memory_consumption(const TrilinosWrappers::PreconditionILU &preconditioner)
+{
+  // In parallel, the ILU factorization of the local matrix is wrapped in an
+  // additive Schwarz preconditioner
+  const Epetra_Operator &op = preconditioner.trilinos_operator();
+  const Ifpack_ILU *     ilu = dynamic_cast<const Ifpack_ILU *>(&op);
+  if (ilu == nullptr)
+    {
+      const auto schwarz =
+        dynamic_cast<const Ifpack_AdditiveSchwarz<Ifpack_ILU> *>(&op);
+      if (schwarz != nullptr)
+        ilu = schwarz->Inverse();
+    }
+
+  if (ilu == nullptr || !ilu->IsComputed())
+    return 0;
+
+  // Values and column indices of the entries of the factors, and offsets of
+  // their rows
+  const std::size_t n_entries =
+    ilu->L().NumMyNonzeros() + ilu->U().NumMyNonzeros();
+  const std::size_t n_rows = ilu->L().NumMyRows() + ilu->U().NumMyRows();
+  return n_entries * (sizeof(double) + sizeof(int)) +
+         n_rows * sizeof(int) + ilu->D().MyLength() * sizeof(double);
+}
@@ -35,7 +35,9 @@ namespace Parameters
       prm.declare_entry("max cfl",
                         "1",
                         Patterns::Double(),
-                        "Maximum CFL value");
+                        "Maximum CFL value. For the DEM, maximum ratio of the "
+                        "time step to the critical time step (Rayleigh time "
+                        "step and Hertzian collision time)");
       prm.declare_entry("stop tolerance",
                         "1e-10",
                         Patterns::Double(),
@@ -45,6 +47,22 @@ namespace Parameters
                         "1.1",
                         Patterns::Double(),
                         "Adaptative time step scaling");
+      prm.declare_entry(
+        "adaptative time step criterion",
+        "cfl",
+        Patterns::Selection("cfl|error"),
+        "Criterion used to adapt the time step. "
+        "Choices are <cfl|error>. cfl bounds the time step by the maximal CFL. "
+        "error controls the time step with an estimate of the local truncation "
+        "error of the BDF schemes, obtained by comparing the velocity, the "
+        "temperature and the tracer with their extrapolation from the "
+        "previous time steps.");
+      prm.declare_entry("error tolerance",
+                        "1e-4",
+                        Patterns::Double(0),
+                        "Tolerance on the relative local truncation error "
+                        "when the time step is adapted with the error "
+                        "criterion");
       prm.declare_entry("output path",
                         "./",
                         Patterns::FileName(),
@@ -96,6 +114,29 @@ namespace Parameters
                         "1",
                         Patterns::Integer(),
                         "Maximal number of vtu output files");
+
+      prm.declare_entry(
+        "asynchronous output",
+        "false",
+        Patterns::Bool(),
+        "Write the results on a background thread while the simulation "
+        "proceeds. Every rank writes its own vtu file and the group files "
+        "parameter is ignored.");
+
+      prm.declare_entry(
+        "output format",
+        "vtu",
+        Patterns::Selection("vtu|hdf5"),
+        "File format of the results <vtu|hdf5>. "
+        "The hdf5 format writes a single file per output, collectively on all "
+        "the ranks, along with an xdmf file that stores the time associated "
+        "with each output. The group files and asynchronous output parameters "
+        "are ignored with this format.");
+
+      prm.declare_entry("hdf5 compression",
+                        "false",
+                        Patterns::Bool(),
+                        "Compress the data written in the hdf5 files");
     }
     prm.leave_subsection();
   }
@@ -141,6 +182,17 @@ namespace Parameters
       stop_tolerance = prm.get_double("stop tolerance");
       adaptative_time_step_scaling =
         prm.get_double("adaptative time step scaling");
+
+      const std::string criterion = prm.get("adaptative time step criterion");
+      if (criterion == "cfl")
+        adaptation_criterion = TimeStepAdaptationCriterion::cfl;
+      else if (criterion == "error")
+        adaptation_criterion = TimeStepAdaptationCriterion::error;
+      else
+        {
+          throw std::logic_error("Invalid adaptative time step criterion");
+        }
+      error_tolerance = prm.get_double("error tolerance");
       startup_timestep_scaling = prm.get_double("startup time scaling");
       number_mesh_adaptation   = prm.get_integer("number mesh adapt");
 
@@ -153,6 +205,19 @@ namespace Parameters
       group_files   = prm.get_integer("group files");
       log_frequency = prm.get_integer("log frequency");
       log_precision = prm.get_integer("log precision");
+
+      asynchronous_output = prm.get_bool("asynchronous output");
+
+      const std::string ofsv = prm.get("output format");
+      if (ofsv == "vtu")
+        output_format = OutputFormat::vtu;
+      else if (ofsv == "hdf5")
+        output_format = OutputFormat::hdf5;
+      else
+        {
+          throw std::logic_error("Invalid output format");
+        }
+      hdf5_compression = prm.get_bool("hdf5 compression");
     }
     prm.leave_subsection();
   }
@@ -167,6 +232,30 @@ namespace Parameters
                         Patterns::Selection("none|iteration|end"),
                         "Clock monitoring methods "
                         "Choices are <none|iteration|end>.");
+      prm.declare_entry("mpi statistics",
+                        "false",
+                        Patterns::Bool(),
+                        "Print the minimum, average and maximum time of each "
+                        "section over the processes at the end");
+      prm.declare_entry("csv output frequency",
+                        "0",
+                        Patterns::Integer(),
+                        "Frequency at which the time spent in each section "
+                        "since the previous output is written to a CSV file. "
+                        "Only supported by the DEM solver.");
+      prm.declare_entry("csv output file",
+                        "timer",
+                        Patterns::FileName(),
+                        "Name of the CSV file of the section timings");
+      prm.declare_entry("memory report",
+                        "false",
+                        Patterns::Bool(),
+                        "Print the minimum and maximum memory used by the "
+                        "processes for the main data structures at setup and "
+                        "after each mesh adaptation or load balance. For the "
+                        "fluid dynamics, it is printed at the end of the "
+                        "following linear solve, so that it includes the "
+                        "preconditioner");
     }
     prm.leave_subsection();
   }
@@ -183,6 +272,10 @@ namespace Parameters
         type = Type::iteration;
       else if (cl == "end")
         type = Type::end;
+      mpi_statistics       = prm.get_bool("mpi statistics");
+      csv_output_frequency = prm.get_integer("csv output frequency");
+      csv_output_file      = prm.get("csv output file");
+      memory_report        = prm.get_bool("memory report");
     }
     prm.leave_subsection();
   }
@@ -483,6 +576,30 @@ namespace Parameters
                         "4",
                         Patterns::Integer(),
                         "Number of digits displayed when showing residuals");
+
+      prm.declare_entry(
+        "extrapolate initial guess",
+        "false",
+        Patterns::Bool(),
+        "Start the non-linear solver of the BDF time steps from the "
+        "extrapolation of the solutions of the previous time steps instead of "
+        "the solution of the last time step. The average number of non-linear "
+        "iterations is reported at the end of the simulation. Its reference "
+        "is a separate simulation without extrapolation.");
+
+      prm.declare_entry(
+        "telemetry",
+        "none",
+        Patterns::Selection("none|csv|json"),
+        "Record the convergence of the non-linear and linear solvers in a "
+        "file written at the end of every time step. Choices are "
+        "<none|csv|json>. In the json format, each line is a JSON object.");
+
+      prm.declare_entry("telemetry file",
+                        "solver_telemetry",
+                        Patterns::FileName(),
+                        "Prefix of the telemetry files. The name of the "
+                        "physics and the extension are appended.");
     }
     prm.leave_subsection();
   }
@@ -513,6 +630,20 @@ namespace Parameters
       max_iterations    = prm.get_integer("max iterations");
       skip_iterations   = prm.get_integer("skip iterations");
       display_precision = prm.get_integer("residual precision");
+
+      extrapolate_initial_guess = prm.get_bool("extrapolate initial guess");
+
+      const std::string str_telemetry = prm.get("telemetry");
+      if (str_telemetry == "none")
+        telemetry = Telemetry::none;
+      else if (str_telemetry == "csv")
+        telemetry = Telemetry::csv;
+      else if (str_telemetry == "json")
+        telemetry = Telemetry::json;
+      else
+        throw(std::runtime_error("Invalid telemetry format"));
+
+      telemetry_file = prm.get("telemetry file");
     }
     prm.leave_subsection();
   }
@@ -565,6 +696,24 @@ namespace Parameters
                         Patterns::Double(),
                         "Target size of the initial refinement");
 
+      prm.declare_entry(
+        "reader group size",
+        "0",
+        Patterns::Integer(0),
+        "Number of processes that share a single reader of the GMSH file. "
+        "The reader parses and partitions the mesh and sends its part to "
+        "every process of its group. 0 means that a single process reads the "
+        "mesh for all processes.");
+
+      prm.declare_entry(
+        "cache",
+        "false",
+        Patterns::Bool(),
+        "Write a binary cache of the GMSH file next to it and read it instead "
+        "of the GMSH file in subsequent runs. For simplex meshes, the cache is "
+        "pre-partitioned and is only reused with the same number of "
+        "processes.");
+
 
       prm.declare_entry("grid type", "hyper_cube");
       prm.declare_entry("grid arguments", "-1 : 1 : false");
@@ -600,6 +749,8 @@ namespace Parameters
       refine_until_target_size = prm.get_bool("enable target size");
       simplex                  = prm.get_bool("simplex");
       target_size              = prm.get_double("target size");
+      reader_group_size        = prm.get_integer("reader group size");
+      cache                    = prm.get_bool("cache");
     }
     prm.leave_subsection();
   }
@@ -767,11 +918,20 @@ namespace Parameters
                         "Type of mesh adaptation"
                         "Choices are <none|uniform|kelly>.");
 
-      prm.declare_entry("variable",
-                        "velocity",
-                        Patterns::Selection("velocity|pressure"),
-                        "Variable for kelly estimation"
-                        "Choices are <velocity|pressure>.");
+      prm.declare_entry(
+        "variable",
+        "velocity",
+        Patterns::List(Patterns::Selection(
+          "velocity|pressure|vorticity|q_criterion|temperature|tracer")),
+        "Variables for the estimation of the refinement indicator. When "
+        "more than one variable is given, their normalized indicators are "
+        "combined. Choices are "
+        "<velocity|pressure|vorticity|q_criterion|temperature|tracer>.");
+      prm.declare_entry("variable weights",
+                        "",
+                        Patterns::List(Patterns::Double()),
+                        "Weights of the variables in the combined indicator. "
+                        "All the variables have the same weight if empty.");
       prm.declare_entry(
         "fraction type",
         "number",
@@ -819,11 +979,36 @@ namespace Parameters
       if (op == "kelly")
         type = Type::kelly;
 
-      const std::string vop = prm.get("variable");
-      if (vop == "velocity")
-        variable = Variable::velocity;
-      if (vop == "pressure")
-        variable = Variable::pressure;
+      const std::vector<std::string> vops =
+        Utilities::split_string_list(prm.get("variable"));
+      variables.clear();
+      for (const auto &vop : vops)
+        {
+          if (vop == "velocity")
+            variables.push_back(Variable::velocity);
+          else if (vop == "pressure")
+            variables.push_back(Variable::pressure);
+          else if (vop == "vorticity")
+            variables.push_back(Variable::vorticity);
+          else if (vop == "q_criterion")
+            variables.push_back(Variable::q_criterion);
+          else if (vop == "temperature")
+            variables.push_back(Variable::temperature);
+          else if (vop == "tracer")
+            variables.push_back(Variable::tracer);
+        }
+      if (variables.empty())
+        throw std::logic_error(
+          "At least one variable is required for the mesh adaptation.");
+
+      variable_weights = Utilities::string_to_double(
+        Utilities::split_string_list(prm.get("variable weights")));
+      if (variable_weights.empty())
+        variable_weights.resize(variables.size(), 1.);
+      if (variable_weights.size() != variables.size())
+        throw std::logic_error(
+          "The number of mesh adaptation variable weights does not match the "
+          "number of variables.");
 
       const std::string fop = prm.get("fraction type");
       if (fop == "number")
@@ -1073,6 +1258,13 @@ namespace Parameters
                         "1",
                         Patterns::Double(),
                         "relaxation parameter");
+      prm.declare_entry(
+        "cut cell weight",
+        "0",
+        Patterns::Integer(),
+        "Additional weight of a cell cut by a particle when the triangulation "
+        "is repartitioned during mesh adaptation, every cell having a "
+        "weight of 1000. The repartitioning is not weighted if it is 0.");
 
       prm.enter_subsection("particle info 0");
       {
@@ -1147,6 +1339,7 @@ namespace Parameters
       density              = prm.get_double("fluid density");
       integrate_motion     = prm.get_bool("integrate motion");
       alpha                = prm.get_double("alpha");
+      cut_cell_weight      = prm.get_integer("cut cell weight");
       gravity[0]           = prm.get_double("gravity_x");
       gravity[1]           = prm.get_double("gravity_y");
       if (dim == 3)
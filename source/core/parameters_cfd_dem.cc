@@ -23,6 +23,20 @@ namespace Parameters
                       "dem",
                       Patterns::FileName(),
                       "File output dem prefix");
+    prm.declare_entry(
+      "dem time series",
+      "false",
+      Patterns::Bool(),
+      "Replay a time series of DEM checkpoints named <dem file name>.XXXXX "
+      "and interpolate the void fraction in time between them");
+    prm.declare_entry("dem time series size",
+                      "1",
+                      Patterns::Integer(),
+                      "Number of DEM checkpoints in the time series");
+    prm.declare_entry("dem time series period",
+                      "1",
+                      Patterns::Double(),
+                      "Time interval between two DEM checkpoints");
     prm.leave_subsection();
   }
 
@@ -45,6 +59,10 @@ namespace Parameters
     read_dem      = prm.get_bool("read dem");
     dem_file_name = prm.get("dem file name");
 
+    dem_time_series        = prm.get_bool("dem time series");
+    dem_time_series_size   = prm.get_integer("dem time series size");
+    dem_time_series_period = prm.get_double("dem time series period");
+
     prm.leave_subsection();
   }
 
@@ -431,6 +431,43 @@ namespace Parameters
                           Patterns::Integer(),
                           "Checking frequency for dynamic load-balancing");
 
+        prm.declare_entry(
+          "dynamic load balance criterion",
+          "particles",
+          Patterns::Selection("particles|time"),
+          "Imbalance measure for dynamic load-balancing, the number of "
+          "particles or the time spent on the particles by the processes. "
+          "Choices are <particles|time>.");
+
+        prm.declare_entry(
+          "load balance weight type",
+          "particles",
+          Patterns::Selection("particles|contacts"),
+          "Weight the cells by their number of particles, or by their number "
+          "of particles and of contacts, for load-balancing. "
+          "Choices are <particles|contacts>.");
+
+        prm.declare_entry(
+          "load balance particle weight",
+          "10000",
+          Patterns::Integer(),
+          "Weight of a particle for load-balancing, the weight of a cell "
+          "being 1000");
+
+        prm.declare_entry(
+          "load balance contact weight",
+          "10000",
+          Patterns::Integer(),
+          "Weight of a contact for load-balancing with the contacts weight "
+          "type, the weight of a cell being 1000");
+
+        prm.declare_entry(
+          "load balance weight calibration",
+          "false",
+          Patterns::Bool(),
+          "Calibrate the particle weight before each load-balancing from the "
+          "time spent by the processes on their particles and cells");
+
 
         prm.declare_entry("contact detection method",
                           "dynamic",
@@ -477,9 +514,32 @@ namespace Parameters
         prm.declare_entry(
           "integration method",
           "velocity_verlet",
-          Patterns::Selection("velocity_verlet|explicit_euler|gear3"),
+          Patterns::Selection("velocity_verlet|explicit_euler|gear3|gear5"),
           "Choosing integration method"
-          "Choices are <velocity_verlet|explicit_euler|gear3>.");
+          "Choices are <velocity_verlet|explicit_euler|gear3|gear5>.");
+
+        prm.declare_entry(
+          "particle wall sub-steps",
+          "1",
+          Patterns::Integer(1),
+          "Number of sub-steps of the particle-wall contact forces in each "
+          "time step. Only available with the velocity_verlet integration "
+          "method");
+
+        prm.declare_entry(
+          "rayleigh time step ratio",
+          "0.15",
+          Patterns::Double(0),
+          "Maximal ratio of the time step to the Rayleigh time step of the "
+          "particles when the time step is adapted");
+
+        prm.declare_entry(
+          "collision time resolution",
+          "20",
+          Patterns::Double(1),
+          "Minimal number of time steps, or of particle-wall sub-steps, in "
+          "the Hertzian collision time of a contact when the time step is "
+          "adapted");
       }
       prm.leave_subsection();
     }
@@ -518,6 +578,35 @@ namespace Parameters
             throw(std::runtime_error("Invalid load-balance method "));
           }
 
+        const std::string criterion = prm.get("dynamic load balance criterion");
+        if (criterion == "particles")
+          dynamic_load_balance_criterion =
+            DynamicLoadBalanceCriterion::particles;
+        else if (criterion == "time")
+          dynamic_load_balance_criterion = DynamicLoadBalanceCriterion::time;
+        else
+          {
+            throw(std::runtime_error(
+              "Invalid dynamic load-balance criterion "));
+          }
+
+        const std::string weight_type = prm.get("load balance weight type");
+        if (weight_type == "particles")
+          load_balance_weight_type = LoadBalanceWeightType::particles;
+        else if (weight_type == "contacts")
+          load_balance_weight_type = LoadBalanceWeightType::contacts;
+        else
+          {
+            throw(std::runtime_error("Invalid load-balance weight type "));
+          }
+
+        load_balance_particle_weight =
+          prm.get_integer("load balance particle weight");
+        load_balance_contact_weight =
+          prm.get_integer("load balance contact weight");
+        load_balance_weight_calibration =
+          prm.get_bool("load balance weight calibration");
+
         const std::string contact_search = prm.get("contact detection method");
         if (contact_search == "constant")
           {
@@ -590,10 +679,114 @@ namespace Parameters
           integration_method = IntegrationMethod::explicit_euler;
         else if (integration == "gear3")
           integration_method = IntegrationMethod::gear3;
+        else if (integration == "gear5")
+          integration_method = IntegrationMethod::gear5;
         else
           {
             throw(std::runtime_error("Invalid integration method "));
           }
+
+        particle_wall_sub_steps = prm.get_integer("particle wall sub-steps");
+        if (particle_wall_sub_steps > 1 &&
+            integration_method != IntegrationMethod::velocity_verlet)
+          {
+            throw(std::runtime_error(
+              "Particle-wall sub-steps require the velocity_verlet "
+              "integration method "));
+          }
+
+        rayleigh_time_step_ratio = prm.get_double("rayleigh time step ratio");
+        collision_time_resolution =
+          prm.get_double("collision time resolution");
+      }
+      prm.leave_subsection();
+    }
+
+    void
+    OutputFilter::declare_parameters(ParameterHandler &prm)
+    {
+      prm.enter_subsection("output filter");
+      {
+        prm.declare_entry(
+          "fields",
+          "ID, Type, Diameter, Velocity, Omega",
+          Patterns::List(
+            Patterns::Selection("ID|Type|Diameter|Velocity|Omega|Mass")),
+          "Particle fields that are written in the output files. The mass is "
+          "only written when it is selected. "
+          "Choices are <ID|Type|Diameter|Velocity|Omega|Mass>.");
+        prm.declare_entry("particle stride",
+                          "1",
+                          Patterns::Integer(1),
+                          "Only the particles whose id is a multiple of the "
+                          "stride are written in the output files");
+        prm.declare_entry("region filter",
+                          "false",
+                          Patterns::Bool(),
+                          "Only write the particles located inside the "
+                          "output region box");
+        prm.declare_entry("region box minimum x",
+                          "0",
+                          Patterns::Double(),
+                          "Output region x min");
+        prm.declare_entry("region box minimum y",
+                          "0",
+                          Patterns::Double(),
+                          "Output region y min");
+        prm.declare_entry("region box minimum z",
+                          "0",
+                          Patterns::Double(),
+                          "Output region z min");
+        prm.declare_entry("region box maximum x",
+                          "0",
+                          Patterns::Double(),
+                          "Output region x max");
+        prm.declare_entry("region box maximum y",
+                          "0",
+                          Patterns::Double(),
+                          "Output region y max");
+        prm.declare_entry("region box maximum z",
+                          "0",
+                          Patterns::Double(),
+                          "Output region z max");
+        prm.declare_entry("grid output",
+                          "always",
+                          Patterns::Selection("always|once|repartition"),
+                          "Output of the background grid. The grid is written "
+                          "at every output, only at the first output or at "
+                          "the first output and after every repartition. "
+                          "Choices are <always|once|repartition>.");
+      }
+      prm.leave_subsection();
+    }
+
+    void
+    OutputFilter::parse_parameters(ParameterHandler &prm)
+    {
+      prm.enter_subsection("output filter");
+      {
+        fields = Utilities::split_string_list(prm.get("fields"));
+
+        particle_stride = prm.get_integer("particle stride");
+        region_filter   = prm.get_bool("region filter");
+        x_min           = prm.get_double("region box minimum x");
+        y_min           = prm.get_double("region box minimum y");
+        z_min           = prm.get_double("region box minimum z");
+        x_max           = prm.get_double("region box maximum x");
+        y_max           = prm.get_double("region box maximum y");
+        z_max           = prm.get_double("region box maximum z");
+
+        const std::string grid = prm.get("grid output");
+        if (grid == "always")
+          grid_output = GridOutput::always;
+        else if (grid == "once")
+          grid_output = GridOutput::once;
+        else if (grid == "repartition")
+          grid_output = GridOutput::repartition;
+        else
+          {
+            throw(std::runtime_error("Invalid grid output "));
+          }
       }
       prm.leave_subsection();
     }
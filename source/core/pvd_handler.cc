@@ -1,22 +1,74 @@
-
 #include "core/pvd_handler.h"
 
 #include <fstream>
+#include <iomanip>
 
 using namespace dealii;
 
+namespace
+{
+  // Closing tags of the pvd file. New entries are written in their place.
+  const std::string pvd_closing_tags = "  </Collection>\n</VTKFile>\n";
+
+  // Width of the number of entries at the beginning of the checkpoint file,
+  // which allows it to be overwritten in place
+  const unsigned int size_width = 10;
+
+  void
+  write_pvd_entries(std::ostream &                                     output,
+                    const std::vector<std::pair<double, std::string>> &entries,
+                    const unsigned int                                 first)
+  {
+    const std::streamsize precision = output.precision();
+    output.precision(12);
+    for (unsigned int i = first; i < entries.size(); ++i)
+      output << "    <DataSet timestep=\"" << entries[i].first
+             << "\" group=\"\" part=\"0\" file=\"" << entries[i].second
+             << "\"/>\n";
+    output.precision(precision);
+  }
+} // namespace
+
 void
 PVDHandler::save(std::string prefix)
 {
-  std::string   filename = prefix + ".pvdhandler";
+  std::string filename = prefix + ".pvdhandler";
+
+  // Only append the new entries if the file was saved by this handler.
+  // The number of entries at the beginning of the file has a fixed width and
+  // is updated in place.
+  if (filename == saved_filename && n_entries_saved > 0 &&
+      n_entries_saved <= times_and_names.size())
+    {
+      std::fstream output(filename.c_str(), std::ios::in | std::ios::out);
+      if (output)
+        {
+          output.seekp(0, std::ios::beg);
+          output << std::setw(size_width) << times_and_names.size()
+                 << std::endl;
+          output.seekp(0, std::ios::end);
+          for (unsigned int i = n_entries_saved; i < times_and_names.size();
+               ++i)
+            {
+              output << times_and_names[i].first << " "
+                     << times_and_names[i].second << std::endl;
+            }
+          n_entries_saved = times_and_names.size();
+          return;
+        }
+    }
+
   std::ofstream output(filename.c_str());
-  output << times_and_names.size() << std::endl;
+  output << std::setw(size_width) << times_and_names.size() << std::endl;
   output << "Time File" << std::endl;
   for (unsigned int i = 0; i < times_and_names.size(); ++i)
     {
       output << times_and_names[i].first << " " << times_and_names[i].second
              << std::endl;
     }
+
+  saved_filename  = filename;
+  n_entries_saved = times_and_names.size();
 }
 
 void
@@ -44,4 +96,41 @@ PVDHandler::read(std::string prefix)
 
   if (size != times_and_names.size())
     throw std::runtime_error("Error when reading pvd restart file ");
+
+  // The checkpoint file may have been written by an older version with a
+  // different layout and the pvd file may contain outputs written after the
+  // checkpoint. Both are thus entirely rewritten the next time.
+  n_entries_saved   = 0;
+  n_entries_written = 0;
+}
+
+void
+PVDHandler::write_pvd(const std::string &pvd_filename)
+{
+  if (pvd_filename == written_pvd_filename && n_entries_written > 0 &&
+      n_entries_written <= times_and_names.size())
+    {
+      std::fstream output(pvd_filename.c_str(),
+                          std::ios::in | std::ios::out | std::ios::binary);
+      if (output)
+        {
+          output.seekp(-static_cast<std::streamoff>(pvd_closing_tags.size()),
+                       std::ios::end);
+          write_pvd_entries(output, times_and_names, n_entries_written);
+          output << pvd_closing_tags;
+          n_entries_written = times_and_names.size();
+          return;
+        }
+    }
+
+  std::ofstream output(pvd_filename.c_str(), std::ios::binary);
+  output << "<?xml version=\"1.0\"?>\n";
+  output << "<VTKFile type=\"Collection\" version=\"0.1\" "
+            "ByteOrder=\"LittleEndian\">\n";
+  output << "  <Collection>\n";
+  write_pvd_entries(output, times_and_names, 0);
+  output << pvd_closing_tags;
+
+  written_pvd_filename = pvd_filename;
+  n_entries_written    = times_and_names.size();
 }
@@ -1,9 +1,13 @@
 #include "core/simulation_control.h"
 
+#include <algorithm>
 #include <cfloat>
+#include <cmath>
 #include <fstream>
+#include <iomanip>
 
 #include "core/parameters.h"
+#include "core/time_integration_utilities.h"
 
 
 SimulationControl::SimulationControl(Parameters::SimulationControl param)
@@ -43,6 +47,25 @@ SimulationControl::add_time_step(double p_timestep)
   time_step_vector[0] = p_timestep;
 }
 
+unsigned int
+SimulationControl::get_extrapolation_n_points(
+  const unsigned int max_n_points) const
+{
+  unsigned int order = 0;
+  if (method == Parameters::SimulationControl::TimeSteppingMethod::bdf1)
+    order = 1;
+  else if (method == Parameters::SimulationControl::TimeSteppingMethod::bdf2)
+    order = 2;
+  else if (method == Parameters::SimulationControl::TimeSteppingMethod::bdf3)
+    order = 3;
+
+  const unsigned int n_points =
+    std::min({order + 1, max_n_points, iteration_number});
+
+  // A single previous solution does not provide an extrapolation
+  return (order > 0 && n_points > 1) ? n_points : 0;
+}
+
 bool
 SimulationControl::is_output_iteration()
 {
@@ -60,6 +83,7 @@ SimulationControl::save(std::string prefix)
 {
   std::string   filename = prefix + ".simulationcontrol";
   std::ofstream output(filename.c_str());
+  output << std::setprecision(12);
   output << "Simulation control" << std::endl;
   for (unsigned int i = 0; i < time_step_vector.size(); ++i)
     output << "dt_" << i << " " << time_step_vector[i] << std::endl;
@@ -158,6 +182,21 @@ SimulationControlTransientDEM::SimulationControlTransientDEM(
   : SimulationControlTransient(param)
 {}
 
+double
+SimulationControlTransientDEM::calculate_time_step()
+{
+  double new_time_step = time_step;
+
+  if (adapt && iteration_number > 1 && CFL > 0)
+    new_time_step =
+      time_step * std::min(adaptative_time_step_scaling, 1. / CFL);
+
+  if (current_time + new_time_step > end_time)
+    new_time_step = end_time - current_time;
+
+  return new_time_step;
+}
+
 void
 SimulationControlTransientDEM::print_progression(
   const ConditionalOStream &pcout)
@@ -171,7 +210,11 @@ SimulationControlTransientDEM::print_progression(
   pcout << "Transient iteration : " << std::setw(8) << std::left
         << iteration_number << " Time : " << std::setw(8) << std::left
         << current_time << " Time step : " << std::setw(8) << std::left
-        << time_step << std::endl;
+        << time_step;
+  if (adapt)
+    pcout << " CFL : " << std::setw(8) << std::left
+          << SimulationControl::get_CFL();
+  pcout << std::endl;
   pcout << "*****************************************************************"
         << std::endl;
 }
@@ -225,6 +268,154 @@ SimulationControlTransientDynamicOutput::is_output_iteration()
 }
 
 
+SimulationControlTransientErrorControlled::
+  SimulationControlTransientErrorControlled(Parameters::SimulationControl param)
+  : SimulationControlTransient(param)
+  , error_tolerance(param.error_tolerance)
+  , error_estimate(-1.)
+  , previous_error_estimate(-1.)
+  , error_estimate_n_points(0)
+  , restart_iteration_number(0)
+{
+  AssertThrow(is_bdf(method),
+              ExcMessage("The error controlled adaptative time stepping "
+                         "requires a BDF time stepping method."));
+}
+
+void
+SimulationControlTransientErrorControlled::print_progression(
+  const ConditionalOStream &pcout)
+{
+  if (!is_verbose_iteration())
+    return;
+
+  pcout << std::endl;
+  pcout << "*****************************************************************"
+        << std::endl;
+  pcout << "Transient iteration : " << std::setw(8) << std::left
+        << iteration_number << " Time : " << std::setw(8) << std::left
+        << current_time << " Time step : " << std::setw(8) << std::left
+        << time_step << " Error : " << std::setw(8) << std::left
+        << previous_error_estimate << std::endl;
+  pcout << "*****************************************************************"
+        << std::endl;
+}
+
+unsigned int
+SimulationControlTransientErrorControlled::get_error_estimate_n_points()
+{
+  // The solvers do not write their fourth previous solution in the
+  // checkpoints, it is only available from the second time step after a
+  // restart
+  unsigned int max_n_points = 4;
+  if (restart_iteration_number > 0)
+    max_n_points =
+      std::min(max_n_points, iteration_number - restart_iteration_number + 2);
+
+  error_estimate_n_points = get_extrapolation_n_points(max_n_points);
+  return error_estimate_n_points;
+}
+
+void
+SimulationControlTransientErrorControlled::provide_error_estimate(
+  const double relative_difference)
+{
+  // The difference between the BDF solution of order p and its extrapolation
+  // from p+1 previous solutions is (1+C) h^(p+1) u^(p+1), where C is the error
+  // constant of the BDF scheme. The local truncation error is thus C/(1+C)
+  // times the difference. When fewer previous solutions are available, the
+  // difference is of lower order and is used as is. In both cases, the order
+  // of the estimate is the number of points used by the controller.
+  double error_constant = 1.;
+  if (error_estimate_n_points == 2 && is_bdf1(method))
+    error_constant = 1. / 3.;
+  else if (error_estimate_n_points == 3 &&
+           method == Parameters::SimulationControl::TimeSteppingMethod::bdf2)
+    error_constant = 2. / 11.;
+  else if (error_estimate_n_points == 4 &&
+           method == Parameters::SimulationControl::TimeSteppingMethod::bdf3)
+    error_constant = 3. / 25.;
+
+  error_estimate =
+    std::max(error_estimate, error_constant * relative_difference);
+}
+
+void
+SimulationControlTransientErrorControlled::save(std::string prefix)
+{
+  SimulationControl::save(prefix);
+
+  std::string   filename = prefix + ".simulationcontrol";
+  std::ofstream output(filename.c_str(), std::ios::app);
+  output << std::setprecision(12);
+  output << "Error_estimate " << error_estimate << std::endl;
+  output << "Previous_error_estimate " << previous_error_estimate
+         << std::endl;
+  output << "Error_estimate_points " << error_estimate_n_points << std::endl;
+}
+
+void
+SimulationControlTransientErrorControlled::read(std::string prefix)
+{
+  SimulationControl::read(prefix);
+  time_step                = time_step_vector[0];
+  restart_iteration_number = iteration_number;
+
+  std::string   filename = prefix + ".simulationcontrol";
+  std::ifstream input(filename.c_str());
+  AssertThrow(input, ExcFileNotOpen(filename));
+
+  std::string key;
+  while (input >> key)
+    {
+      if (key == "Error_estimate")
+        input >> error_estimate;
+      else if (key == "Previous_error_estimate")
+        input >> previous_error_estimate;
+      else if (key == "Error_estimate_points")
+        input >> error_estimate_n_points;
+    }
+}
+
+double
+SimulationControlTransientErrorControlled::calculate_time_step()
+{
+  double new_time_step = time_step;
+
+  if (error_estimate >= 0 && error_estimate_n_points > 1)
+    {
+      const double safety     = 0.9;
+      const double min_factor = 0.2;
+      const double max_factor = std::max(adaptative_time_step_scaling, 1.);
+      const double k          = error_estimate_n_points;
+
+      double factor = max_factor;
+      if (error_estimate > 0)
+        {
+          // PI controller of Gustafsson. The integral part drives the error
+          // toward the tolerance and the proportional part damps the
+          // oscillations of the time step.
+          factor = safety * std::pow(error_tolerance / error_estimate, 0.3 / k);
+          if (previous_error_estimate > 0)
+            factor *=
+              std::pow(previous_error_estimate / error_estimate, 0.4 / k);
+          else
+            factor *= std::pow(error_tolerance / error_estimate, 0.7 / k);
+        }
+      factor        = std::min(max_factor, std::max(min_factor, factor));
+      new_time_step = time_step * factor;
+
+      previous_error_estimate = error_estimate;
+    }
+  error_estimate = -1.;
+
+  if (current_time + new_time_step > end_time)
+    new_time_step = end_time - current_time;
+
+  return new_time_step;
+}
+
+
 SimulationControlSteady::SimulationControlSteady(
   Parameters::SimulationControl param)
   : SimulationControl(param)
@@ -62,7 +62,17 @@ SolidBase<dim, spacedim>::SolidBase(
   , param(param)
   , velocity(&param->solid_velocity)
   , degree_velocity(degree_velocity)
-{}
+{
+  if (param->solid_velocity_type ==
+      Parameters::NitscheSolid<spacedim>::SolidVelocityType::rigid_body)
+    {
+      rigid_body_velocity = std::make_shared<RigidBodyVelocity<spacedim>>(
+        param->translational_velocity,
+        param->angular_velocity,
+        param->center_of_rotation);
+      velocity = rigid_body_velocity.get();
+    }
+}
 
 template <int dim, int spacedim>
 void
@@ -320,8 +330,16 @@ SolidBase<dim, spacedim>::get_solid_velocity()
 
 template <int dim, int spacedim>
 void
-SolidBase<dim, spacedim>::integrate_velocity(double time_step)
+SolidBase<dim, spacedim>::integrate_velocity(double       time_step,
+                                             const double initial_time)
 {
+  // The particles of a solid at rest are neither moved nor sorted
+  if (is_at_rest())
+    {
+      velocity->set_time(initial_time + time_step);
+      return;
+    }
+
   const unsigned int sub_particles_iterations = param->particles_sub_iterations;
   AssertThrow(sub_particles_iterations >= 1,
               ExcMessage("Sub particles iterations must be 1 or larger"));
@@ -333,37 +351,32 @@ SolidBase<dim, spacedim>::integrate_velocity(double time_step)
   // approaches. The number of sub particles iterations must be chosen so that
   // the time_step / sub_particles_iterations  * velocity / cell size is smaller
   // than unity
+  std::vector<Point<spacedim>> particle_locations;
+  particle_locations.reserve(
+    solid_particle_handler->n_locally_owned_particles());
   for (unsigned int it = 0; it < sub_particles_iterations; ++it)
     {
+      particle_locations.clear();
       for (auto particle = solid_particle_handler->begin();
            particle != solid_particle_handler->end();
            ++particle)
-        {
-          Point<spacedim> particle_location = particle->get_location();
-
-          Tensor<1, spacedim> k1;
-          for (unsigned int comp_i = 0; comp_i < spacedim; ++comp_i)
-            k1[comp_i] = velocity->value(particle_location, comp_i);
+        particle_locations.push_back(particle->get_location());
 
-          Point<spacedim>     p1 = particle_location + time_step / 2 * k1;
-          Tensor<1, spacedim> k2;
-          for (unsigned int comp_i = 0; comp_i < spacedim; ++comp_i)
-            k2[comp_i] = velocity->value(p1, comp_i);
+      integrate_points_rk4(particle_locations,
+                           initial_time + it * time_step,
+                           time_step);
 
-          Point<spacedim>     p2 = particle_location + time_step / 2 * k2;
-          Tensor<1, spacedim> k3;
-          for (unsigned int comp_i = 0; comp_i < spacedim; ++comp_i)
-            k3[comp_i] = velocity->value(p2, comp_i);
-
-          Point<spacedim>     p3 = particle_location + time_step * k3;
-          Tensor<1, spacedim> k4;
-          for (unsigned int comp_i = 0; comp_i < spacedim; ++comp_i)
-            k4[comp_i] = velocity->value(p3, comp_i);
-
-          particle_location += time_step / 6 * (k1 + 2 * k2 + 2 * k3 + k4);
-          particle->set_location(particle_location);
-        }
-      solid_particle_handler->sort_particles_into_subdomains_and_cells();
+      unsigned int i = 0;
+      for (auto particle = solid_particle_handler->begin();
+           particle != solid_particle_handler->end();
+           ++particle, ++i)
+        particle->set_location(particle_locations[i]);
+
+      // The particles are sorted at the end of the time step, which also
+      // updates their reference location. Within the sub iterations, they are
+      // only sorted if one of them has left its cell.
+      if (it + 1 == sub_particles_iterations || particles_left_their_cell())
+        solid_particle_handler->sort_particles_into_subdomains_and_cells();
     }
 
   if (initial_number_of_particles !=
@@ -384,11 +397,21 @@ SolidBase<dim, spacedim>::integrate_velocity(double time_step)
 
 template <int dim, int spacedim>
 void
-SolidBase<dim, spacedim>::move_solid_triangulation(double time_step)
+SolidBase<dim, spacedim>::move_solid_triangulation(double       time_step,
+                                                   const double initial_time)
 {
+  if (is_at_rest())
+    {
+      velocity->set_time(initial_time + time_step);
+      return;
+    }
+
   const unsigned int n_dofs = solid_dh.n_dofs();
   std::vector<bool>  displacement(n_dofs, false);
 
+  // Gather every vertex once so that they are all moved at the same time
+  std::vector<Point<spacedim> *> vertices;
+  std::vector<Point<spacedim>>   vertex_positions;
   for (const auto &cell : solid_dh.active_cell_iterators())
     {
       if (cell->is_locally_owned())
@@ -399,35 +422,81 @@ SolidBase<dim, spacedim>::move_solid_triangulation(double time_step)
             {
               if (!displacement[cell->vertex_index(i)])
                 {
-                  Point<spacedim> &vertex_position = cell->vertex(i);
+                  vertices.push_back(&cell->vertex(i));
+                  vertex_positions.push_back(cell->vertex(i));
+
+                  displacement[cell->vertex_index(i)] = true;
+                }
+            }
+        }
+    }
 
-                  Tensor<1, spacedim> k1;
-                  for (unsigned int comp_i = 0; comp_i < spacedim; ++comp_i)
-                    k1[comp_i] = velocity->value(vertex_position, comp_i);
+  integrate_points_rk4(vertex_positions, initial_time, time_step);
 
-                  Point<spacedim>     p1 = vertex_position + time_step / 2 * k1;
-                  Tensor<1, spacedim> k2;
-                  for (unsigned int comp_i = 0; comp_i < spacedim; ++comp_i)
-                    k2[comp_i] = velocity->value(p1, comp_i);
+  for (unsigned int i = 0; i < vertices.size(); ++i)
+    *vertices[i] = vertex_positions[i];
+}
+
+template <int dim, int spacedim>
+void
+SolidBase<dim, spacedim>::integrate_points_rk4(
+  std::vector<Point<spacedim>> &points,
+  const double                  initial_time,
+  const double                  time_step) const
+{
+  const unsigned int n_points = points.size();
 
-                  Point<spacedim>     p2 = vertex_position + time_step / 2 * k2;
-                  Tensor<1, spacedim> k3;
-                  for (unsigned int comp_i = 0; comp_i < spacedim; ++comp_i)
-                    k3[comp_i] = velocity->value(p2, comp_i);
+  std::vector<std::vector<Vector<double>>> k(
+    4, std::vector<Vector<double>>(n_points, Vector<double>(spacedim)));
+  std::vector<Point<spacedim>> stage_points(points);
 
-                  Point<spacedim>     p3 = vertex_position + time_step * k3;
-                  Tensor<1, spacedim> k4;
-                  for (unsigned int comp_i = 0; comp_i < spacedim; ++comp_i)
-                    k4[comp_i] = velocity->value(p3, comp_i);
+  // Velocity at the beginning of the step and at the three stages
+  const double stage_time_step[3] = {time_step / 2, time_step / 2, time_step};
+  velocity->set_time(initial_time);
+  velocity->vector_value_list(stage_points, k[0]);
+  for (unsigned int stage = 1; stage < 4; ++stage)
+    {
+      for (unsigned int i = 0; i < n_points; ++i)
+        for (unsigned int d = 0; d < spacedim; ++d)
+          stage_points[i][d] =
+            points[i][d] + stage_time_step[stage - 1] * k[stage - 1][i][d];
+      velocity->set_time(initial_time + stage_time_step[stage - 1]);
+      velocity->vector_value_list(stage_points, k[stage]);
+    }
 
-                  vertex_position +=
-                    time_step / 6 * (k1 + 2 * k2 + 2 * k3 + k4);
+  for (unsigned int i = 0; i < n_points; ++i)
+    for (unsigned int d = 0; d < spacedim; ++d)
+      points[i][d] += time_step / 6 *
+                      (k[0][i][d] + 2 * k[1][i][d] + 2 * k[2][i][d] +
+                       k[3][i][d]);
+}
 
-                  displacement[cell->vertex_index(i)] = true;
-                }
-            }
+template <int dim, int spacedim>
+bool
+SolidBase<dim, spacedim>::is_at_rest() const
+{
+  // The motion of a parsed velocity is not known in advance
+  return rigid_body_velocity && rigid_body_velocity->is_at_rest();
+}
+
+template <int dim, int spacedim>
+bool
+SolidBase<dim, spacedim>::particles_left_their_cell() const
+{
+  unsigned int particle_left_cell = 0;
+  for (auto particle = solid_particle_handler->begin();
+       particle != solid_particle_handler->end();
+       ++particle)
+    {
+      const auto &cell = particle->get_surrounding_cell(*fluid_tria);
+      if (!cell->point_inside(particle->get_location()))
+        {
+          particle_left_cell = 1;
+          break;
         }
     }
+
+  return Utilities::MPI::max(particle_left_cell, mpi_communicator) > 0;
 }
 
 template <int dim, int spacedim>
@@ -1,6 +1,11 @@
 // dealii includes
 #include <deal.II/numerics/data_out.h>
 
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
 
 // Lethe includes
 #include <core/manifolds.h>
@@ -50,8 +55,7 @@ write_vtu_and_pvd(PVDHandler &                           pvd_handler,
 
       std::string pvdPrefix = (folder + file_prefix + ".pvd");
       pvd_handler.append(time, pvtu_filename);
-      std::ofstream pvd_output(pvdPrefix.c_str());
-      DataOutBase::write_pvd_record(pvd_output, pvd_handler.times_and_names);
+      pvd_handler.write_pvd(pvdPrefix);
     }
 
   const unsigned int my_file_id =
@@ -70,6 +74,74 @@ write_vtu_and_pvd(PVDHandler &                           pvd_handler,
   }
 }
 
+template <int dim, int spacedim>
+void
+write_hdf5_and_xdmf(std::vector<XDMFEntry> &         xdmf_entries,
+                    DataOutInterface<dim, spacedim> &data_out,
+                    const std::string                folder,
+                    const std::string                file_prefix,
+                    const double                     time,
+                    const unsigned int               iter,
+                    const bool                       compression,
+                    const MPI_Comm &                 mpi_communicator,
+                    const unsigned int               digits)
+{
+#if (DEAL_II_VERSION_MINOR <= 2)
+  AssertThrow(!compression,
+              ExcMessage("Compression of the hdf5 output requires deal.II 9.3 "
+                         "or a more recent version."));
+#else
+  DataOutBase::Hdf5Flags hdf5_flags;
+  hdf5_flags.compression_level =
+    compression ? DataOutBase::CompressionLevel::best_speed :
+                  DataOutBase::CompressionLevel::no_compression;
+  data_out.set_flags(hdf5_flags);
+#endif
+
+  // Duplicated vertices are merged so that the mesh is stored only once
+  DataOutBase::DataOutFilter data_filter(
+    DataOutBase::DataOutFilterFlags(true, true));
+  data_out.write_filtered_data(data_filter);
+
+  const std::string h5_filename =
+    file_prefix + "." + Utilities::int_to_string(iter, digits) + ".h5";
+  data_out.write_hdf5_parallel(data_filter,
+                               folder + h5_filename,
+                               mpi_communicator);
+
+  // The hdf5 file is referenced relatively to the xdmf file since both are
+  // in the same folder
+  xdmf_entries.push_back(data_out.create_xdmf_entry(data_filter,
+                                                    h5_filename,
+                                                    time,
+                                                    mpi_communicator));
+  data_out.write_xdmf_file(xdmf_entries,
+                           folder + file_prefix + ".xdmf",
+                           mpi_communicator);
+}
+
+void
+save_xdmf_entries(const std::vector<XDMFEntry> &xdmf_entries,
+                  const std::string &           prefix)
+{
+  std::ofstream                 output(prefix + ".xdmfentries");
+  boost::archive::text_oarchive oa(output);
+  oa << xdmf_entries;
+}
+
+void
+read_xdmf_entries(std::vector<XDMFEntry> &xdmf_entries,
+                  const std::string &     prefix)
+{
+  xdmf_entries.clear();
+  std::ifstream input(prefix + ".xdmfentries");
+  if (!input)
+    return;
+
+  boost::archive::text_iarchive ia(input);
+  ia >> xdmf_entries;
+}
+
 template <int dim>
 void
 write_boundaries_vtu(const DataOutFaces<dim> &data_out_faces,
@@ -94,6 +166,126 @@ write_boundaries_vtu(const DataOutFaces<dim> &data_out_faces,
   MPI_Comm_free(&comm);
 }
 
+template <int dim>
+void
+DetachedDataOut<dim>::detach()
+{
+  detached_dataset_names         = DataOut<dim>::get_dataset_names();
+  detached_nonscalar_data_ranges = DataOut<dim>::get_nonscalar_data_ranges();
+  detached_patches.swap(this->patches);
+  detached = true;
+
+  // Release the DoFHandler, the data vectors and the postprocessors
+  this->clear();
+}
+
+template <int dim>
+const std::vector<DataOutBase::Patch<dim, dim>> &
+DetachedDataOut<dim>::get_patches() const
+{
+  if (detached)
+    return detached_patches;
+  return DataOut<dim>::get_patches();
+}
+
+template <int dim>
+std::vector<std::string>
+DetachedDataOut<dim>::get_dataset_names() const
+{
+  if (detached)
+    return detached_dataset_names;
+  return DataOut<dim>::get_dataset_names();
+}
+
+template <int dim>
+std::vector<
+  std::tuple<unsigned int,
+             unsigned int,
+             std::string,
+             DataComponentInterpretation::DataComponentInterpretation>>
+DetachedDataOut<dim>::get_nonscalar_data_ranges() const
+{
+  if (detached)
+    return detached_nonscalar_data_ranges;
+  return DataOut<dim>::get_nonscalar_data_ranges();
+}
+
+template <int dim>
+AsynchronousVTUWriter<dim>::~AsynchronousVTUWriter()
+{
+  if (pending_write.valid())
+    pending_write.wait();
+}
+
+template <int dim>
+void
+AsynchronousVTUWriter<dim>::wait()
+{
+  // get() rethrows the exceptions that occurred on the background thread
+  if (pending_write.valid())
+    pending_write.get();
+}
+
+template <int dim>
+void
+AsynchronousVTUWriter<dim>::write_vtu_and_pvd(
+  PVDHandler &                          pvd_handler,
+  std::shared_ptr<DetachedDataOut<dim>> data_out,
+  const std::string                     folder,
+  const std::string                     file_prefix,
+  const double                          time,
+  const unsigned int                    iter,
+  const MPI_Comm &                      mpi_communicator,
+  const unsigned int                    digits)
+{
+  // Only block if the previous output has not been written yet
+  wait();
+
+  data_out->detach();
+
+  const unsigned int my_id = Utilities::MPI::this_mpi_process(mpi_communicator);
+  const unsigned int n_processes =
+    Utilities::MPI::n_mpi_processes(mpi_communicator);
+  const std::string iter_prefix =
+    file_prefix + "." + Utilities::int_to_string(iter, digits);
+
+  // The pvd handler is updated right away since it is part of the checkpoint
+  std::vector<std::string> filenames;
+  if (my_id == 0)
+    {
+      for (unsigned int i = 0; i < n_processes; ++i)
+        filenames.push_back(iter_prefix + "." +
+                            Utilities::int_to_string(i, digits) + ".vtu");
+
+      pvd_handler.append(time, iter_prefix + ".pvtu");
+    }
+
+  // The pvd handler is only appended to once this output is written, so it
+  // can be used on the background thread
+  PVDHandler *pvd_handler_ptr = &pvd_handler;
+  pending_write = std::async(std::launch::async, [=]() {
+    const std::string filename =
+      folder + iter_prefix + "." + Utilities::int_to_string(my_id, digits) +
+      ".vtu";
+    std::ofstream output(filename.c_str());
+    data_out->write_vtu(output);
+
+    if (my_id == 0)
+      {
+        std::string   pvtu_filename_with_folder = folder + iter_prefix + ".pvtu";
+        std::ofstream master_output(pvtu_filename_with_folder.c_str());
+        data_out->write_pvtu_record(master_output, filenames);
+
+        std::string pvdPrefix = (folder + file_prefix + ".pvd");
+        pvd_handler_ptr->write_pvd(pvdPrefix);
+      }
+  });
+}
+
+template class DetachedDataOut<2>;
+template class DetachedDataOut<3>;
+template class AsynchronousVTUWriter<2>;
+template class AsynchronousVTUWriter<3>;
 
 template void
 write_vtu_and_pvd(PVDHandler &                  pvd_handler,
@@ -151,6 +343,61 @@ write_vtu_and_pvd(PVDHandler &                  pvd_handler,
                   const unsigned int            digits);
 
 
+template void
+write_hdf5_and_xdmf(std::vector<XDMFEntry> &xdmf_entries,
+                    DataOutInterface<2, 2> &data_out,
+                    const std::string       folder,
+                    const std::string       file_prefix,
+                    const double            time,
+                    const unsigned int      iter,
+                    const bool              compression,
+                    const MPI_Comm &        mpi_communicator,
+                    const unsigned int      digits);
+
+template void
+write_hdf5_and_xdmf(std::vector<XDMFEntry> &xdmf_entries,
+                    DataOutInterface<2, 3> &data_out,
+                    const std::string       folder,
+                    const std::string       file_prefix,
+                    const double            time,
+                    const unsigned int      iter,
+                    const bool              compression,
+                    const MPI_Comm &        mpi_communicator,
+                    const unsigned int      digits);
+
+template void
+write_hdf5_and_xdmf(std::vector<XDMFEntry> &xdmf_entries,
+                    DataOutInterface<3, 3> &data_out,
+                    const std::string       folder,
+                    const std::string       file_prefix,
+                    const double            time,
+                    const unsigned int      iter,
+                    const bool              compression,
+                    const MPI_Comm &        mpi_communicator,
+                    const unsigned int      digits);
+
+template void
+write_hdf5_and_xdmf(std::vector<XDMFEntry> &xdmf_entries,
+                    DataOutInterface<0, 2> &data_out,
+                    const std::string       folder,
+                    const std::string       file_prefix,
+                    const double            time,
+                    const unsigned int      iter,
+                    const bool              compression,
+                    const MPI_Comm &        mpi_communicator,
+                    const unsigned int      digits);
+
+template void
+write_hdf5_and_xdmf(std::vector<XDMFEntry> &xdmf_entries,
+                    DataOutInterface<0, 3> &data_out,
+                    const std::string       folder,
+                    const std::string       file_prefix,
+                    const double            time,
+                    const unsigned int      iter,
+                    const bool              compression,
+                    const MPI_Comm &        mpi_communicator,
+                    const unsigned int      digits);
+
 template void
 write_boundaries_vtu(const DataOutFaces<2> &data_out_faces,
                      const std::string      folder,
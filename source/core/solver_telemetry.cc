@@ -0,0 +1,172 @@
+#include "core/solver_telemetry.h"
+
+#include <deal.II/base/mpi.h>
+
+#include <fstream>
+#include <iomanip>
+
+using namespace dealii;
+
+namespace
+{
+  // Writes the entries of a vector separated by spaces in CSV files and as a
+  // JSON array otherwise
+  template <typename T>
+  void
+  write_list(std::ostream &output, const std::vector<T> &list, const bool json)
+  {
+    if (json)
+      output << "[";
+    for (unsigned int i = 0; i < list.size(); ++i)
+      output << (i > 0 ? (json ? ", " : " ") : "") << list[i];
+    if (json)
+      output << "]";
+  }
+} // namespace
+
+SolverTelemetry::SolverTelemetry()
+  : enabled(false)
+  , format(Parameters::NonLinearSolver::Telemetry::none)
+{}
+
+void
+SolverTelemetry::initialize(
+  const Parameters::NonLinearSolver::Telemetry telemetry_format,
+  const std::string &                          file_prefix)
+{
+  format  = telemetry_format;
+  enabled = (format != Parameters::NonLinearSolver::Telemetry::none);
+  if (!enabled)
+    return;
+
+  const bool json = (format == Parameters::NonLinearSolver::Telemetry::json);
+  file_name       = file_prefix + (json ? ".json" : ".csv");
+
+  if (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    {
+      std::ofstream output(file_name);
+      if (!json)
+        output << "step,time,solve,newton_iterations,initial_residual,"
+               << "final_residual,alphas,linear_iterations,"
+               << "preconditioner_setups,preconditioner_setup_time,"
+               << "fill_increases" << std::endl;
+    }
+}
+
+SolverTelemetry::NonLinearSolveRecord &
+SolverTelemetry::current_record()
+{
+  if (records.empty())
+    records.emplace_back();
+  return records.back();
+}
+
+void
+SolverTelemetry::start_non_linear_solve(const double initial_residual)
+{
+  if (!enabled)
+    return;
+
+  records.emplace_back();
+  records.back().initial_residual = initial_residual;
+}
+
+void
+SolverTelemetry::add_newton_iteration(const double alpha,
+                                      const double residual)
+{
+  if (!enabled)
+    return;
+
+  auto &record = current_record();
+  record.alphas.push_back(alpha);
+  record.residuals.push_back(residual);
+}
+
+void
+SolverTelemetry::add_linear_solve(const unsigned int n_iterations)
+{
+  if (!enabled)
+    return;
+
+  current_record().linear_iterations.push_back(n_iterations);
+}
+
+void
+SolverTelemetry::add_preconditioner_setup(const double wall_time)
+{
+  if (!enabled)
+    return;
+
+  auto &record = current_record();
+  record.n_preconditioner_setups += 1;
+  record.preconditioner_setup_time += wall_time;
+}
+
+void
+SolverTelemetry::add_fill_increase()
+{
+  if (!enabled)
+    return;
+
+  current_record().n_fill_increases += 1;
+}
+
+void
+SolverTelemetry::write(const unsigned int step_number, const double time)
+{
+  if (!enabled)
+    return;
+
+  if (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    {
+      const bool json =
+        (format == Parameters::NonLinearSolver::Telemetry::json);
+
+      std::ofstream output(file_name, std::ios::app);
+      output << std::setprecision(8);
+
+      for (unsigned int s = 0; s < records.size(); ++s)
+        {
+          const auto & record = records[s];
+          const double final_residual =
+            record.residuals.empty() ? record.initial_residual :
+                                       record.residuals.back();
+
+          if (json)
+            {
+              output << "{\"step\": " << step_number << ", \"time\": " << time
+                     << ", \"solve\": " << s
+                     << ", \"newton_iterations\": " << record.alphas.size()
+                     << ", \"initial_residual\": " << record.initial_residual
+                     << ", \"final_residual\": " << final_residual
+                     << ", \"alphas\": ";
+              write_list(output, record.alphas, true);
+              output << ", \"residuals\": ";
+              write_list(output, record.residuals, true);
+              output << ", \"linear_iterations\": ";
+              write_list(output, record.linear_iterations, true);
+              output << ", \"preconditioner_setups\": "
+                     << record.n_preconditioner_setups
+                     << ", \"preconditioner_setup_time\": "
+                     << record.preconditioner_setup_time
+                     << ", \"fill_increases\": " << record.n_fill_increases
+                     << "}" << std::endl;
+            }
+          else
+            {
+              output << step_number << "," << time << "," << s << ","
+                     << record.alphas.size() << "," << record.initial_residual
+                     << "," << final_residual << ",";
+              write_list(output, record.alphas, false);
+              output << ",";
+              write_list(output, record.linear_iterations, false);
+              output << "," << record.n_preconditioner_setups << ","
+                     << record.preconditioner_setup_time << ","
+                     << record.n_fill_increases << std::endl;
+            }
+        }
+    }
+
+  records.clear();
+}
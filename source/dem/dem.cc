@@ -21,9 +21,15 @@
 #include <deal.II/grid/grid_generator.h>
 #include <deal.II/grid/grid_out.h>
 
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
 #include <core/solutions_output.h>
 #include <dem/dem.h>
 
+#include <algorithm>
+#include <iterator>
+
 template <int dim>
 DEMSolver<dim>::DEMSolver(DEMSolverParameters<dim> dem_parameters)
   : mpi_communicator(MPI_COMM_WORLD)
@@ -46,12 +52,33 @@ DEMSolver<dim>::DEMSolver(DEMSolverParameters<dim> dem_parameters)
   , contact_detection_frequency(
       parameters.model_parameters.contact_detection_frequency)
   , insertion_frequency(parameters.insertion_info.insertion_frequency)
+  , multiple_time_step_integrator_object(
+      parameters.model_parameters.particle_wall_sub_steps)
   , standard_deviation_multiplier(2.5)
   , background_dh(triangulation)
+  , background_grid_output_required(true)
+  , particle_weight(parameters.model_parameters.load_balance_particle_weight)
+  , contact_weight(parameters.model_parameters.load_balance_contact_weight)
+  , measure_particle_work(
+      parameters.model_parameters.load_balance_weight_calibration ||
+      (parameters.model_parameters.load_balance_method ==
+         Parameters::Lagrangian::ModelParameters::LoadBalanceMethod::dynamic &&
+       parameters.model_parameters.dynamic_load_balance_criterion ==
+         Parameters::Lagrangian::ModelParameters::DynamicLoadBalanceCriterion::
+           time))
+  , particle_work_particles(0)
+  , particle_work_contacts(0)
+  , particle_work_steps(0)
+  , particle_work_time_at_check(0)
+  , timer_statistics_output_started(false)
 {
   // Change the behavior of the timer for situations when you don't want outputs
   if (parameters.timer.type == Parameters::Timer::Type::none)
     computing_timer.disable_output();
+
+  // The timer is started on construction, it only has to run during the
+  // particle work
+  particle_work_timer.reset();
   simulation_control = std::make_shared<SimulationControlTransientDEM>(
     parameters.simulation_control);
 
@@ -159,45 +186,86 @@ DEMSolver<dim>::cell_weight(
   if (!cell->is_locally_owned())
     return 0;
 
-  // This determines how important particle work is compared to cell
-  // work (by default every cell has a weight of 1000).
-  // We set the weight per particle much higher to indicate that
-  // the particle load is the only one that is important to distribute
-  // in this example. The optimal value of this number depends on the
-  // application and can range from 0 (cheap particle operations,
-  // expensive cell operations) to much larger than 1000 (expensive
-  // particle operations, cheap cell operations, like in this case).
-  // This parameter will need to be tuned for the case of DEM.
-  const unsigned int particle_weight = 10000;
+  // The particle weight determines how important particle work is compared
+  // to cell work (by default every cell has a weight of 1000). The optimal
+  // value depends on the application and can range from 0 (cheap particle
+  // operations, expensive cell operations) to much larger than 1000
+  // (expensive particle operations, cheap cell operations). It is either
+  // given in the parameter file or calibrated from the measured timings (see
+  // calibrate_particle_weight()).
 
   // This does not use adaptive refinement, therefore every cell
   // should have the status CELL_PERSIST. However this function can also
   // be used to distribute load during refinement, therefore we consider
   // refined or coarsened cells as well.
+  // p4est stores the weights of the cells as int
+  const std::uint64_t max_weight = std::numeric_limits<int>::max();
+
   if (status == parallel::distributed::Triangulation<dim>::CELL_PERSIST ||
       status == parallel::distributed::Triangulation<dim>::CELL_REFINE)
     {
-      const unsigned int n_particles_in_cell =
-        particle_handler.n_particles_in_cell(cell);
-      return n_particles_in_cell * particle_weight;
+      return std::min(active_cell_weight(cell), max_weight);
     }
   else if (status == parallel::distributed::Triangulation<dim>::CELL_COARSEN)
     {
-      unsigned int n_particles_in_cell = 0;
+      std::uint64_t weight = 0;
 
       for (unsigned int child_index = 0;
            child_index < GeometryInfo<dim>::max_children_per_cell;
            ++child_index)
-        n_particles_in_cell +=
-          particle_handler.n_particles_in_cell(cell->child(child_index));
+        weight += active_cell_weight(cell->child(child_index));
 
-      return n_particles_in_cell * particle_weight;
+      return std::min(weight, max_weight);
     }
 
   Assert(false, ExcInternalError());
   return 0;
 }
 
+template <int dim>
+std::uint64_t
+DEMSolver<dim>::active_cell_weight(
+  const typename Triangulation<dim>::active_cell_iterator &cell) const
+{
+  std::uint64_t weight =
+    static_cast<std::uint64_t>(particle_handler.n_particles_in_cell(cell)) *
+    particle_weight;
+
+  if (parameters.model_parameters.load_balance_weight_type ==
+      Parameters::Lagrangian::ModelParameters::LoadBalanceWeightType::contacts)
+    {
+      std::uint64_t n_contacts_in_cell = 0;
+      for (const auto &particle : particle_handler.particles_in_cell(cell))
+        n_contacts_in_cell += n_particle_contacts(particle.get_id());
+
+      weight += n_contacts_in_cell * contact_weight;
+    }
+
+  return weight;
+}
+
+template <int dim>
+unsigned int
+DEMSolver<dim>::n_particle_contacts(const types::particle_index id) const
+{
+  // Each particle-particle pair is stored once, in the container of one of
+  // its two particles
+  unsigned int n_contacts = 0;
+
+  auto count_contacts = [&](const auto &contact_container) {
+    const auto contacts = contact_container.find(id);
+    if (contacts != contact_container.end())
+      n_contacts += contacts->second.size();
+  };
+
+  count_contacts(local_adjacent_particles);
+  count_contacts(ghost_adjacent_particles);
+  count_contacts(pw_pairs_in_contact);
+  count_contacts(pfw_pairs_in_contact);
+
+  return n_contacts;
+}
+
 template <int dim>
 void
 DEMSolver<dim>::setup_background_dofs()
@@ -210,9 +278,24 @@ template <int dim>
 void
 DEMSolver<dim>::load_balance()
 {
+  if (parameters.model_parameters.load_balance_weight_calibration)
+    calibrate_load_balance_weights();
+
+  particle_work_timer.reset();
+  particle_work_particles     = 0;
+  particle_work_contacts      = 0;
+  particle_work_steps         = 0;
+  particle_work_time_at_check = 0;
+
+  TimerOutput::Scope t(this->computing_timer, "load_balance");
+
   pcout << "-->Repartitionning triangulation" << std::endl;
   triangulation.repartition();
 
+  if (parameters.output_filter.grid_output ==
+      Parameters::Lagrangian::OutputFilter::GridOutput::repartition)
+    background_grid_output_required = true;
+
   cells_local_neighbor_list.clear();
   cells_ghost_neighbor_list.clear();
 
@@ -239,6 +322,88 @@ DEMSolver<dim>::load_balance()
   pcout << "Minimum and maximum number of cells owned by the processors are "
         << average_minimum_maximum_cells.min << " and "
         << average_minimum_maximum_cells.max << std::endl;
+
+  if (parameters.timer.memory_report)
+    print_memory_usage();
+}
+
+template <int dim>
+void
+DEMSolver<dim>::calibrate_load_balance_weights()
+{
+  // Weight of a cell in the repartitioning of a distributed triangulation
+  const double reference_cell_weight = 1000;
+
+  const bool contacts_weighted =
+    parameters.model_parameters.load_balance_weight_type ==
+    Parameters::Lagrangian::ModelParameters::LoadBalanceWeightType::contacts;
+
+  if (particle_work_steps > 0)
+    {
+      // Average work of the process per step: number of cells, of particles
+      // and of contacts, and time
+      std::vector<double> work = {
+        static_cast<double>(triangulation.n_locally_owned_active_cells()),
+        particle_work_particles / particle_work_steps};
+      if (contacts_weighted)
+        work.push_back(particle_work_contacts / particle_work_steps);
+      const unsigned int n_variables = work.size();
+      const double       step_time =
+        particle_work_timer.wall_time() / particle_work_steps;
+
+      // Normal equations of the least-squares fit of the step time of the
+      // processes by a linear function of their work
+      std::vector<double> local_sums;
+      for (unsigned int i = 0; i < n_variables; ++i)
+        {
+          for (unsigned int j = 0; j < n_variables; ++j)
+            local_sums.push_back(work[i] * work[j]);
+          local_sums.push_back(work[i] * step_time);
+        }
+      std::vector<double> sums(local_sums.size());
+      Utilities::MPI::sum(local_sums, mpi_communicator, sums);
+
+      FullMatrix<double> normal_matrix(n_variables, n_variables);
+      Vector<double>     normal_rhs(n_variables);
+      double             diagonal_product = 1;
+      for (unsigned int i = 0; i < n_variables; ++i)
+        {
+          for (unsigned int j = 0; j < n_variables; ++j)
+            normal_matrix(i, j) = sums[i * (n_variables + 1) + j];
+          normal_rhs(i) = sums[i * (n_variables + 1) + n_variables];
+          diagonal_product *= normal_matrix(i, i);
+        }
+
+      if (normal_matrix.determinant() > 1e-6 * diagonal_product)
+        {
+          normal_matrix.gauss_jordan();
+          Vector<double> coefficients(n_variables);
+          normal_matrix.vmult(coefficients, normal_rhs);
+
+          bool positive_coefficients = true;
+          for (unsigned int i = 0; i < n_variables; ++i)
+            positive_coefficients &= (coefficients(i) > 0);
+
+          if (positive_coefficients)
+            {
+              particle_weight = static_cast<unsigned int>(
+                std::round(std::min(reference_cell_weight * coefficients(1) /
+                                      coefficients(0),
+                                    1e9)));
+              if (contacts_weighted)
+                contact_weight = static_cast<unsigned int>(
+                  std::round(std::min(reference_cell_weight * coefficients(2) /
+                                        coefficients(0),
+                                      1e9)));
+            }
+        }
+    }
+
+  pcout << "Particle weight for load-balancing: " << particle_weight
+        << std::endl;
+  if (contacts_weighted)
+    pcout << "Contact weight for load-balancing: " << contact_weight
+          << std::endl;
 }
 
 template <int dim>
@@ -285,20 +450,46 @@ DEMSolver<dim>::check_load_balance_dynamic()
         parameters.model_parameters.dynamic_load_balance_check_frequency ==
       0)
     {
-      unsigned int maximum_particle_number_on_proc = 0;
-      unsigned int minimum_particle_number_on_proc = 0;
+      bool imbalanced = false;
 
-      maximum_particle_number_on_proc =
-        Utilities::MPI::max(particle_handler.n_locally_owned_particles(),
-                            mpi_communicator);
-      minimum_particle_number_on_proc =
-        Utilities::MPI::min(particle_handler.n_locally_owned_particles(),
-                            mpi_communicator);
+      if (parameters.model_parameters.dynamic_load_balance_criterion ==
+          Parameters::Lagrangian::ModelParameters::DynamicLoadBalanceCriterion::
+            particles)
+        {
+          unsigned int maximum_particle_number_on_proc = 0;
+          unsigned int minimum_particle_number_on_proc = 0;
 
-      if ((maximum_particle_number_on_proc - minimum_particle_number_on_proc) >
+          maximum_particle_number_on_proc =
+            Utilities::MPI::max(particle_handler.n_locally_owned_particles(),
+                                mpi_communicator);
+          minimum_particle_number_on_proc =
+            Utilities::MPI::min(particle_handler.n_locally_owned_particles(),
+                                mpi_communicator);
+
+          imbalanced =
+            (maximum_particle_number_on_proc -
+             minimum_particle_number_on_proc) >
             parameters.model_parameters.load_balance_threshold *
-              (particle_handler.n_global_particles() / n_mpi_processes) ||
-          checkpoint_step)
+              (particle_handler.n_global_particles() / n_mpi_processes);
+        }
+      else
+        {
+          // Time spent on the particles by each process since the last check.
+          // Contrary to the total step time, it does not include the time
+          // spent waiting for the other processes.
+          const double work_time =
+            particle_work_timer.wall_time() - particle_work_time_at_check;
+          particle_work_time_at_check = particle_work_timer.wall_time();
+
+          const auto work_time_statistics =
+            Utilities::MPI::min_max_avg(work_time, mpi_communicator);
+
+          imbalanced = (work_time_statistics.max - work_time_statistics.min) >
+                       parameters.model_parameters.load_balance_threshold *
+                         work_time_statistics.avg;
+        }
+
+      if (imbalanced || checkpoint_step)
         {
           load_balance();
           load_balance_step = true;
@@ -341,6 +532,7 @@ DEMSolver<dim>::insert_particles()
 {
   if ((simulation_control->get_step_number() % insertion_frequency) == 1)
     {
+      TimerOutput::Scope t(this->computing_timer, "particle_insertion");
       insertion_object->insert(particle_handler, triangulation, parameters);
       return true;
     }
@@ -370,6 +562,8 @@ template <int dim>
 void
 DEMSolver<dim>::particle_wall_broad_search()
 {
+  TimerOutput::Scope t(this->computing_timer, "pw_broad_search");
+
   // Particle - wall contact candidates
   pw_broad_search_object.find_particle_wall_contact_pairs(
     boundary_cell_object.get_boundary_cells_information(),
@@ -405,6 +599,8 @@ template <int dim>
 void
 DEMSolver<dim>::particle_wall_fine_search()
 {
+  TimerOutput::Scope t(this->computing_timer, "pw_fine_search");
+
   // Particle - wall fine search
   pw_fine_search_object.particle_wall_fine_search(pw_contact_candidates,
                                                   pw_pairs_in_contact);
@@ -433,20 +629,23 @@ DEMSolver<dim>::particle_wall_fine_search()
 
 template <int dim>
 void
-DEMSolver<dim>::particle_wall_contact_force()
+DEMSolver<dim>::particle_wall_contact_force(const double dt)
 {
+  TimerOutput::Scope t(this->computing_timer, "pw_contact_force");
+
   // Particle-wall contact force
-  pw_contact_force_object->calculate_pw_contact_force(
-    pw_pairs_in_contact, simulation_control->get_time_step(), momentum, force);
+  pw_contact_force_object->calculate_pw_contact_force(pw_pairs_in_contact,
+                                                      dt,
+                                                      momentum,
+                                                      force);
 
   // Particle-floating wall contact force
   if (parameters.floating_walls.floating_walls_number > 0)
     {
-      pw_contact_force_object->calculate_pw_contact_force(
-        pfw_pairs_in_contact,
-        simulation_control->get_time_step(),
-        momentum,
-        force);
+      pw_contact_force_object->calculate_pw_contact_force(pfw_pairs_in_contact,
+                                                          dt,
+                                                          momentum,
+                                                          force);
     }
 
   particle_point_line_contact_force_object
@@ -475,6 +674,11 @@ DEMSolver<dim>::finish_simulation()
             << std::endl;
     }
 
+  // Minimum, average and maximum time spent in each section by the processes
+  if (parameters.timer.mpi_statistics &&
+      parameters.timer.type != Parameters::Timer::Type::none)
+    this->computing_timer.print_wall_time_statistics(mpi_communicator);
+
   // Testing
   if (parameters.test.enabled)
     {
@@ -491,6 +695,142 @@ DEMSolver<dim>::finish_simulation()
     }
 }
 
+template <int dim>
+void
+DEMSolver<dim>::write_timer_statistics()
+{
+  const std::map<std::string, double> wall_times =
+    computing_timer.get_summary_data(TimerOutput::total_wall_time);
+
+  // Every section of the solver is written at each output, with a time of 0
+  // for the sections which have not been entered yet, so that all the rows
+  // of the file have the same columns
+  static const std::vector<std::string> timer_statistics_sections = {
+    "particle_insertion",
+    "load_balance",
+    "sort_particles_and_ghost_exchange",
+    "pp_broad_search",
+    "pw_broad_search",
+    "localize_contacts",
+    "pp_fine_search",
+    "pw_fine_search",
+    "pp_contact_force",
+    "pw_contact_force",
+    "integration",
+    "output",
+    "write_checkpoint",
+    "critical_time_step"};
+
+  const std::string filename = parameters.timer.csv_output_file + ".csv";
+  std::ofstream     output;
+  if (this_mpi_process == 0)
+    {
+      if (!timer_statistics_output_started)
+        {
+          output.open(filename.c_str());
+          output << "step,time";
+          for (const auto &section : timer_statistics_sections)
+            output << "," << section << "_min," << section << "_avg,"
+                   << section << "_max";
+          output << std::endl;
+        }
+      else
+        output.open(filename.c_str(), std::ios::app);
+
+      output << simulation_control->get_step_number() << ","
+             << simulation_control->get_current_time();
+    }
+
+  // Wall time spent in each section since the previous output
+  for (const auto &section : timer_statistics_sections)
+    {
+      double section_time = 0;
+
+      const auto wall_time = wall_times.find(section);
+      if (wall_time != wall_times.end())
+        section_time = wall_time->second;
+
+      const auto previous_wall_time = previous_section_wall_times.find(section);
+      if (previous_wall_time != previous_section_wall_times.end())
+        section_time -= previous_wall_time->second;
+
+      const auto statistics =
+        Utilities::MPI::min_max_avg(section_time, mpi_communicator);
+      if (this_mpi_process == 0)
+        output << "," << statistics.min << "," << statistics.avg << ","
+               << statistics.max;
+    }
+
+  if (this_mpi_process == 0)
+    output << std::endl;
+
+  previous_section_wall_times     = wall_times;
+  timer_statistics_output_started = true;
+}
+
+template <int dim>
+void
+DEMSolver<dim>::print_memory_usage()
+{
+  MemoryReport report;
+  report.add_entry("Triangulation", triangulation.memory_consumption());
+
+  // The particles are stored in the particle handler and their properties in
+  // its property pool
+#if (DEAL_II_VERSION_MINOR <= 2)
+  const std::size_t n_ghost_particles = ghost_particle_container.size();
+#else
+  const std::size_t n_ghost_particles =
+    std::distance(particle_handler.begin_ghost(), particle_handler.end_ghost());
+#endif
+  const std::size_t n_particles =
+    particle_handler.n_locally_owned_particles() + n_ghost_particles;
+  report.add_entry("Particle handler",
+                   n_particles *
+                     (sizeof(Particles::Particle<dim>) +
+                      particle_handler.n_properties_per_particle() *
+                        sizeof(double)));
+
+  report.add_entry("Cell neighbor lists",
+                   container_memory_consumption(cells_local_neighbor_list) +
+                     container_memory_consumption(cells_ghost_neighbor_list));
+
+  report.add_entry(
+    "Particle containers",
+    container_memory_consumption(particle_container) +
+      container_memory_consumption(ghost_particle_container) +
+      container_memory_consumption(momentum) +
+      container_memory_consumption(force) +
+      container_memory_consumption(displacement) +
+      container_memory_consumption(MOI));
+
+  report.add_entry(
+    "Contact candidates",
+    container_memory_consumption(local_contact_pair_candidates) +
+      container_memory_consumption(ghost_contact_pair_candidates) +
+      container_memory_consumption(pw_contact_candidates) +
+      container_memory_consumption(pfw_contact_candidates) +
+      container_memory_consumption(particle_point_contact_candidates) +
+      container_memory_consumption(particle_line_contact_candidates));
+
+  report.add_entry("Adjacent particle pairs",
+                   container_memory_consumption(local_adjacent_particles) +
+                     container_memory_consumption(ghost_adjacent_particles));
+
+  report.add_entry(
+    "Contact history",
+    pp_contact_force_object->contact_histories_memory_consumption() +
+      container_memory_consumption(pw_pairs_in_contact) +
+      container_memory_consumption(pfw_pairs_in_contact) +
+      container_memory_consumption(particle_points_in_contact) +
+      container_memory_consumption(particle_lines_in_contact));
+
+  report.print(pcout,
+               mpi_communicator,
+               "at step " +
+                 std::to_string(simulation_control->get_step_number()));
+}
+
 template <int dim>
 std::shared_ptr<Insertion<dim>>
 DEMSolver<dim>::set_insertion_type(const DEMSolverParameters<dim> &parameters)
@@ -535,7 +875,12 @@ DEMSolver<dim>::set_integrator_type(const DEMSolverParameters<dim> &parameters)
   else if (parameters.model_parameters.integration_method ==
            Parameters::Lagrangian::ModelParameters::IntegrationMethod::gear3)
     {
-      integrator_object = std::make_shared<Gear3Integrator<dim>>();
+      integrator_object = std::make_shared<GearIntegrator<dim>>(3);
+    }
+  else if (parameters.model_parameters.integration_method ==
+           Parameters::Lagrangian::ModelParameters::IntegrationMethod::gear5)
+    {
+      integrator_object = std::make_shared<GearIntegrator<dim>>(5);
     }
   else
     {
@@ -604,6 +949,8 @@ template <int dim>
 void
 DEMSolver<dim>::write_output_results()
 {
+  TimerOutput::Scope t(this->computing_timer, "output");
+
   const std::string folder = parameters.simulation_control.output_folder;
   const std::string particles_solution_name =
     parameters.simulation_control.output_name;
@@ -614,41 +961,73 @@ DEMSolver<dim>::write_output_results()
   // Write particles
   Visualization<dim> particle_data_out;
   particle_data_out.build_patches(particle_handler,
-                                  properties_class.get_properties_name());
-
-  write_vtu_and_pvd<0, dim>(particles_pvdhandler,
-                            particle_data_out,
-                            folder,
-                            particles_solution_name,
-                            time,
-                            iter,
-                            group_files,
-                            mpi_communicator);
-
-  // Write background grid
-  DataOut<dim> background_data_out;
-
-  background_data_out.attach_dof_handler(background_dh);
-
-  // Attach the solution data to data_out object
-  Vector<float> subdomain(triangulation.n_active_cells());
-  for (unsigned int i = 0; i < subdomain.size(); ++i)
-    subdomain(i) = triangulation.locally_owned_subdomain();
-  background_data_out.add_data_vector(subdomain, "subdomain");
-
-  const std::string grid_solution_name =
-    parameters.simulation_control.output_name + "-grid";
-
-  background_data_out.build_patches();
-
-  write_vtu_and_pvd<dim>(grid_pvdhandler,
-                         background_data_out,
-                         folder,
-                         grid_solution_name,
-                         time,
-                         iter,
-                         group_files,
-                         mpi_communicator);
+                                  properties_class.get_properties_name(),
+                                  parameters.output_filter);
+
+  const bool hdf5_output = parameters.simulation_control.output_format ==
+                           Parameters::SimulationControl::OutputFormat::hdf5;
+
+  if (hdf5_output)
+    write_hdf5_and_xdmf<0, dim>(particles_xdmf_entries,
+                                particle_data_out,
+                                folder,
+                                particles_solution_name,
+                                time,
+                                iter,
+                                parameters.simulation_control.hdf5_compression,
+                                mpi_communicator);
+  else
+    write_vtu_and_pvd<0, dim>(particles_pvdhandler,
+                              particle_data_out,
+                              folder,
+                              particles_solution_name,
+                              time,
+                              iter,
+                              group_files,
+                              mpi_communicator);
+
+  // Write background grid. Unless it is written at every output, the grid is
+  // only written at the first output and, if requested, after a repartition
+  if (parameters.output_filter.grid_output ==
+        Parameters::Lagrangian::OutputFilter::GridOutput::always ||
+      background_grid_output_required)
+    {
+      DataOut<dim> background_data_out;
+
+      background_data_out.attach_dof_handler(background_dh);
+
+      // Attach the solution data to data_out object
+      Vector<float> subdomain(triangulation.n_active_cells());
+      for (unsigned int i = 0; i < subdomain.size(); ++i)
+        subdomain(i) = triangulation.locally_owned_subdomain();
+      background_data_out.add_data_vector(subdomain, "subdomain");
+
+      const std::string grid_solution_name =
+        parameters.simulation_control.output_name + "-grid";
+
+      background_data_out.build_patches();
+
+      if (hdf5_output)
+        write_hdf5_and_xdmf<dim>(grid_xdmf_entries,
+                                 background_data_out,
+                                 folder,
+                                 grid_solution_name,
+                                 time,
+                                 iter,
+                                 parameters.simulation_control.hdf5_compression,
+                                 mpi_communicator);
+      else
+        write_vtu_and_pvd<dim>(grid_pvdhandler,
+                               background_data_out,
+                               folder,
+                               grid_solution_name,
+                               time,
+                               iter,
+                               group_files,
+                               mpi_communicator);
+
+      background_grid_output_required = false;
+    }
 
   if (simulation_control->get_output_boundaries())
     {
@@ -677,6 +1056,8 @@ DEMSolver<dim>::solve()
                       parameters,
                       simulation_control,
                       particles_pvdhandler,
+                      particles_xdmf_entries,
+                      grid_xdmf_entries,
                       triangulation,
                       particle_handler);
 
@@ -710,6 +1091,9 @@ DEMSolver<dim>::solve()
   pp_contact_force_object = set_pp_contact_force(parameters);
   pw_contact_force_object = set_pw_contact_force(parameters);
 
+  if (parameters.timer.memory_report)
+    print_memory_usage();
+
   // DEM engine iterator:
   while (simulation_control->integrate())
     {
@@ -725,6 +1109,7 @@ DEMSolver<dim>::solve()
       contact_detection_step = (this->*check_contact_search_step)();
 
       // Sort particles in cells
+      computing_timer.enter_subsection("sort_particles_and_ghost_exchange");
       if (particles_insertion_step || load_balance_step ||
           contact_detection_step || checkpoint_step)
         {
@@ -757,17 +1142,37 @@ DEMSolver<dim>::solve()
           particle_handler.update_ghost_particles();
 #endif
         }
+      computing_timer.leave_subsection("sort_particles_and_ghost_exchange");
+
+      // Time spent on the particles, used to calibrate the load balancing
+      // weights and to detect load imbalance
+      if (measure_particle_work)
+        {
+          if (parameters.model_parameters.load_balance_weight_type ==
+              Parameters::Lagrangian::ModelParameters::LoadBalanceWeightType::
+                contacts)
+            for (const auto &particle : particle_handler)
+              particle_work_contacts += n_particle_contacts(particle.get_id());
+
+          particle_work_timer.start();
+          particle_work_particles +=
+            particle_handler.n_locally_owned_particles();
+          ++particle_work_steps;
+        }
 
       // Broad particle-particle contact search
       if (particles_insertion_step || load_balance_step ||
           contact_detection_step)
         {
-          pp_broad_search_object.find_particle_particle_contact_pairs(
-            particle_handler,
-            &cells_local_neighbor_list,
-            &cells_ghost_neighbor_list,
-            local_contact_pair_candidates,
-            ghost_contact_pair_candidates);
+          {
+            TimerOutput::Scope t(this->computing_timer, "pp_broad_search");
+            pp_broad_search_object.find_particle_particle_contact_pairs(
+              particle_handler,
+              &cells_local_neighbor_list,
+              &cells_ghost_neighbor_list,
+              local_contact_pair_candidates,
+              ghost_contact_pair_candidates);
+          }
 
           // Updating number of contact builds
           contact_build_number++;
@@ -775,32 +1180,38 @@ DEMSolver<dim>::solve()
           // Particle-wall broad contact search
           particle_wall_broad_search();
 
-          localize_contacts<dim>(&local_adjacent_particles,
-                                 &ghost_adjacent_particles,
-                                 &pw_pairs_in_contact,
-                                 &pfw_pairs_in_contact,
-                                 local_contact_pair_candidates,
-                                 ghost_contact_pair_candidates,
-                                 pw_contact_candidates,
-                                 pfw_contact_candidates);
-
-          locate_local_particles_in_cells<dim>(particle_handler,
-                                               particle_container,
-                                               ghost_adjacent_particles,
-                                               local_adjacent_particles,
-                                               pw_pairs_in_contact,
-                                               pfw_pairs_in_contact,
-                                               particle_points_in_contact,
-                                               particle_lines_in_contact);
+          {
+            TimerOutput::Scope t(this->computing_timer, "localize_contacts");
+            localize_contacts<dim>(&local_adjacent_particles,
+                                   &ghost_adjacent_particles,
+                                   &pw_pairs_in_contact,
+                                   &pfw_pairs_in_contact,
+                                   local_contact_pair_candidates,
+                                   ghost_contact_pair_candidates,
+                                   pw_contact_candidates,
+                                   pfw_contact_candidates);
+
+            locate_local_particles_in_cells<dim>(particle_handler,
+                                                 particle_container,
+                                                 ghost_adjacent_particles,
+                                                 local_adjacent_particles,
+                                                 pw_pairs_in_contact,
+                                                 pfw_pairs_in_contact,
+                                                 particle_points_in_contact,
+                                                 particle_lines_in_contact);
+          }
 
           // Particle-particle fine search
-          pp_fine_search_object.particle_particle_fine_search(
-            local_contact_pair_candidates,
-            ghost_contact_pair_candidates,
-            local_adjacent_particles,
-            ghost_adjacent_particles,
-            particle_container,
-            neighborhood_threshold_squared);
+          {
+            TimerOutput::Scope t(this->computing_timer, "pp_fine_search");
+            pp_fine_search_object.particle_particle_fine_search(
+              local_contact_pair_candidates,
+              ghost_contact_pair_candidates,
+              local_adjacent_particles,
+              ghost_adjacent_particles,
+              particle_container,
+              neighborhood_threshold_squared);
+          }
 
           // Particles-wall fine search
           particle_wall_fine_search();
@@ -817,35 +1228,112 @@ DEMSolver<dim>::solve()
         }
 
       // Particle-particle contact force
-      pp_contact_force_object->calculate_pp_contact_force(
-        local_adjacent_particles,
-        ghost_adjacent_particles,
-        simulation_control->get_time_step(),
-        momentum,
-        force);
-
-      // Particles-walls contact force:
-      particle_wall_contact_force();
-
-      // Integration correction step (after force calculation)
-      // In the first step, we have to obtain location of particles at half-step
-      // time
-      if (simulation_control->get_step_number() == 0)
+      {
+        TimerOutput::Scope t(this->computing_timer, "pp_contact_force");
+        pp_contact_force_object->calculate_pp_contact_force(
+          local_adjacent_particles,
+          ghost_adjacent_particles,
+          simulation_control->get_time_step(),
+          momentum,
+          force);
+      }
+
+      if (multiple_time_step_integrator_object.get_n_sub_steps() > 1)
         {
-          integrator_object->integrate_half_step_location(
+          // Multiple time stepping: the particle-particle contact forces and
+          // the body force are applied once per time step, while the stiffer
+          // particle-wall contact forces are sub-cycled
+          const bool first_step = (simulation_control->get_step_number() == 0);
+
+          const unsigned int n_sub_steps =
+            multiple_time_step_integrator_object.get_n_sub_steps();
+          const double sub_time_step =
+            multiple_time_step_integrator_object.get_sub_time_step(
+              simulation_control->get_time_step());
+
+          computing_timer.enter_subsection("integration");
+          multiple_time_step_integrator_object.integrate_slow_forces(
             particle_handler,
             parameters.physical_properties.g,
+            simulation_control->get_time_step(),
+            momentum,
             force,
-            simulation_control->get_time_step());
+            MOI,
+            first_step);
+          computing_timer.leave_subsection("integration");
+
+          for (unsigned int sub_step = 0; sub_step < n_sub_steps; ++sub_step)
+            {
+              particle_wall_contact_force(sub_time_step);
+
+              computing_timer.enter_subsection("integration");
+              multiple_time_step_integrator_object.integrate_fast_forces(
+                particle_handler,
+                sub_time_step,
+                momentum,
+                force,
+                MOI,
+                first_step && sub_step == 0);
+              computing_timer.leave_subsection("integration");
+            }
         }
       else
         {
-          integrator_object->integrate(particle_handler,
-                                       parameters.physical_properties.g,
-                                       simulation_control->get_time_step(),
-                                       momentum,
-                                       force,
-                                       MOI);
+          // Particles-walls contact force:
+          particle_wall_contact_force(simulation_control->get_time_step());
+
+          // Integration correction step (after force calculation)
+          // In the first step, we have to obtain location of particles at
+          // half-step time
+          computing_timer.enter_subsection("integration");
+          if (simulation_control->get_step_number() == 0)
+            {
+              integrator_object->integrate_half_step_location(
+                particle_handler,
+                parameters.physical_properties.g,
+                force,
+                simulation_control->get_time_step());
+            }
+          else
+            {
+              integrator_object->integrate(particle_handler,
+                                           parameters.physical_properties.g,
+                                           simulation_control->get_time_step(),
+                                           momentum,
+                                           force,
+                                           MOI);
+            }
+          computing_timer.leave_subsection("integration");
+        }
+
+      if (measure_particle_work)
+        particle_work_timer.stop();
+
+      // Adaptative time stepping: the ratio of the time step to the critical
+      // time step bounds the time step of the next iteration. It is
+      // calculated once the work on the particles is measured, since it
+      // waits for the other processes
+      if (parameters.simulation_control.adapt)
+        {
+          TimerOutput::Scope t(this->computing_timer, "critical_time_step");
+          const double critical_time_step =
+            find_critical_time_step<dim>(particle_handler,
+                                         parameters.physical_properties,
+                                         local_adjacent_particles,
+                                         ghost_adjacent_particles,
+                                         pw_pairs_in_contact,
+                                         pfw_pairs_in_contact,
+                                         parameters.model_parameters
+                                           .rayleigh_time_step_ratio,
+                                         parameters.model_parameters
+                                           .collision_time_resolution,
+                                         multiple_time_step_integrator_object
+                                           .get_n_sub_steps(),
+                                         mpi_communicator);
+
+          if (critical_time_step < std::numeric_limits<double>::max())
+            simulation_control->set_CFL(simulation_control->get_time_step() /
+                                        critical_time_step);
         }
 
       // Visualization
@@ -863,11 +1351,19 @@ DEMSolver<dim>::solve()
                            parameters,
                            simulation_control,
                            particles_pvdhandler,
+                           particles_xdmf_entries,
+                           grid_xdmf_entries,
                            triangulation,
                            particle_handler,
                            pcout,
                            mpi_communicator);
         }
+
+      if (parameters.timer.csv_output_frequency > 0 &&
+          simulation_control->get_step_number() %
+              parameters.timer.csv_output_frequency ==
+            0)
+        write_timer_statistics();
     }
 
   finish_simulation();
@@ -0,0 +1,234 @@
+#include <deal.II/base/mpi.h>
+
+#include <dem/find_critical_time_step.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace dealii;
+
+double
+rayleigh_time_step(const double diameter,
+                   const double density,
+                   const double youngs_modulus,
+                   const double poisson_ratio)
+{
+  return M_PI_2 * diameter *
+         sqrt(2 * density * (2 + poisson_ratio) * (1 - poisson_ratio) /
+              youngs_modulus) /
+         (0.1631 * poisson_ratio + 0.8766);
+}
+
+double
+hertz_collision_time(const double effective_mass,
+                     const double effective_radius,
+                     const double effective_youngs_modulus,
+                     const double normal_impact_velocity)
+{
+  if (normal_impact_velocity <= 0)
+    return std::numeric_limits<double>::max();
+
+  return 2.87 * std::pow(effective_mass * effective_mass /
+                           (effective_radius * effective_youngs_modulus *
+                            effective_youngs_modulus * normal_impact_velocity),
+                         0.2);
+}
+
+template <int dim>
+double
+find_critical_time_step(
+  Particles::ParticleHandler<dim> &                      particle_handler,
+  const Parameters::Lagrangian::PhysicalProperties<dim> &physical_properties,
+  const std::unordered_map<
+    types::particle_index,
+    std::unordered_map<types::particle_index, pp_contact_info_struct<dim>>>
+    &local_adjacent_particles,
+  const std::unordered_map<
+    types::particle_index,
+    std::unordered_map<types::particle_index, pp_contact_info_struct<dim>>>
+    &ghost_adjacent_particles,
+  const std::unordered_map<
+    types::particle_index,
+    std::map<types::particle_index, pw_contact_info_struct<dim>>>
+    &pw_pairs_in_contact,
+  const std::unordered_map<
+    types::particle_index,
+    std::map<types::particle_index, pw_contact_info_struct<dim>>>
+    &                pfw_pairs_in_contact,
+  const double       rayleigh_time_step_ratio,
+  const double       collision_time_resolution,
+  const unsigned int n_wall_sub_steps,
+  const MPI_Comm &   mpi_communicator)
+{
+  double critical_time_step = std::numeric_limits<double>::max();
+
+  // Fraction of the Rayleigh time step of each particle, with its own
+  // diameter. It bounds the time step whether or not there are contacts
+  for (auto &particle : particle_handler)
+    {
+      const auto &       particle_properties = particle.get_properties();
+      const unsigned int particle_type =
+        particle_properties[DEM::PropertiesIndex::type];
+
+      critical_time_step = std::min(
+        critical_time_step,
+        rayleigh_time_step_ratio *
+          rayleigh_time_step(
+            particle_properties[DEM::PropertiesIndex::dp],
+            physical_properties.density.at(particle_type),
+            physical_properties.youngs_modulus_particle.at(particle_type),
+            physical_properties.poisson_ratio_particle.at(particle_type)));
+    }
+
+  // Effective Young's modulus of two bodies in contact
+  const auto effective_youngs_modulus = [](const double youngs_modulus_one,
+                                           const double poisson_ratio_one,
+                                           const double youngs_modulus_two,
+                                           const double poisson_ratio_two) {
+    return (youngs_modulus_one * youngs_modulus_two) /
+           (youngs_modulus_two * (1 - poisson_ratio_one * poisson_ratio_one) +
+            youngs_modulus_one * (1 - poisson_ratio_two * poisson_ratio_two));
+  };
+
+  // Fraction of the collision time of the particle-particle contacts. The
+  // normal relative velocity of the pairs which overlap is calculated from
+  // the particles since it is not stored in the contact information
+  for (const auto *adjacent_particles :
+       {&local_adjacent_particles, &ghost_adjacent_particles})
+    for (const auto &pairs_in_contact : *adjacent_particles)
+      for (const auto &contact : pairs_in_contact.second)
+        {
+          const auto &contact_info = contact.second;
+          const auto  properties_one =
+            contact_info.particle_one->get_properties();
+          const auto properties_two =
+            contact_info.particle_two->get_properties();
+          const Point<dim> location_one =
+            contact_info.particle_one->get_location();
+          const Point<dim> location_two =
+            contact_info.particle_two->get_location();
+
+          const double radius_one =
+            0.5 * properties_one[DEM::PropertiesIndex::dp];
+          const double radius_two =
+            0.5 * properties_two[DEM::PropertiesIndex::dp];
+          const double distance = location_one.distance(location_two);
+
+          if (distance <= 0 || radius_one + radius_two <= distance)
+            continue;
+
+          const Tensor<1, dim> normal_vector =
+            (location_two - location_one) / distance;
+          double normal_relative_velocity = 0;
+          for (int d = 0; d < dim; ++d)
+            normal_relative_velocity +=
+              (properties_one[DEM::PropertiesIndex::v_x + d] -
+               properties_two[DEM::PropertiesIndex::v_x + d]) *
+              normal_vector[d];
+
+          const unsigned int type_one =
+            properties_one[DEM::PropertiesIndex::type];
+          const unsigned int type_two =
+            properties_two[DEM::PropertiesIndex::type];
+          const double mass_one = properties_one[DEM::PropertiesIndex::mass];
+          const double mass_two = properties_two[DEM::PropertiesIndex::mass];
+
+          critical_time_step = std::min(
+            critical_time_step,
+            hertz_collision_time(
+              mass_one * mass_two / (mass_one + mass_two),
+              radius_one * radius_two / (radius_one + radius_two),
+              effective_youngs_modulus(
+                physical_properties.youngs_modulus_particle.at(type_one),
+                physical_properties.poisson_ratio_particle.at(type_one),
+                physical_properties.youngs_modulus_particle.at(type_two),
+                physical_properties.poisson_ratio_particle.at(type_two)),
+              std::abs(normal_relative_velocity)) /
+              collision_time_resolution);
+        }
+
+  // Fraction of the collision time of the particle-wall contacts, with the
+  // normal relative velocity updated by the contact force calculation. It
+  // bounds the sub-step of the particle-wall contact forces
+  for (const auto *pairs_in_contact :
+       {&pw_pairs_in_contact, &pfw_pairs_in_contact})
+    for (const auto &particle_contacts : *pairs_in_contact)
+      for (const auto &contact : particle_contacts.second)
+        {
+          const auto &contact_info = contact.second;
+          if (contact_info.normal_overlap <= 0)
+            continue;
+
+          const auto particle_properties =
+            contact_info.particle->get_properties();
+          const unsigned int particle_type =
+            particle_properties[DEM::PropertiesIndex::type];
+
+          critical_time_step = std::min(
+            critical_time_step,
+            n_wall_sub_steps *
+              hertz_collision_time(
+                particle_properties[DEM::PropertiesIndex::mass],
+                0.5 * particle_properties[DEM::PropertiesIndex::dp],
+                effective_youngs_modulus(
+                  physical_properties.youngs_modulus_particle.at(
+                    particle_type),
+                  physical_properties.poisson_ratio_particle.at(particle_type),
+                  physical_properties.youngs_modulus_wall,
+                  physical_properties.poisson_ratio_wall),
+                std::abs(contact_info.normal_relative_velocity)) /
+              collision_time_resolution);
+        }
+
+  return Utilities::MPI::min(critical_time_step, mpi_communicator);
+}
+
+template double
+find_critical_time_step(
+  Particles::ParticleHandler<2> &                      particle_handler,
+  const Parameters::Lagrangian::PhysicalProperties<2> &physical_properties,
+  const std::unordered_map<
+    types::particle_index,
+    std::unordered_map<types::particle_index, pp_contact_info_struct<2>>>
+    &local_adjacent_particles,
+  const std::unordered_map<
+    types::particle_index,
+    std::unordered_map<types::particle_index, pp_contact_info_struct<2>>>
+    &ghost_adjacent_particles,
+  const std::unordered_map<
+    types::particle_index,
+    std::map<types::particle_index, pw_contact_info_struct<2>>>
+    &pw_pairs_in_contact,
+  const std::unordered_map<
+    types::particle_index,
+    std::map<types::particle_index, pw_contact_info_struct<2>>>
+    &                pfw_pairs_in_contact,
+  const double       rayleigh_time_step_ratio,
+  const double       collision_time_resolution,
+  const unsigned int n_wall_sub_steps,
+  const MPI_Comm &   mpi_communicator);
+
+template double
+find_critical_time_step(
+  Particles::ParticleHandler<3> &                      particle_handler,
+  const Parameters::Lagrangian::PhysicalProperties<3> &physical_properties,
+  const std::unordered_map<
+    types::particle_index,
+    std::unordered_map<types::particle_index, pp_contact_info_struct<3>>>
+    &local_adjacent_particles,
+  const std::unordered_map<
+    types::particle_index,
+    std::unordered_map<types::particle_index, pp_contact_info_struct<3>>>
+    &ghost_adjacent_particles,
+  const std::unordered_map<
+    types::particle_index,
+    std::map<types::particle_index, pw_contact_info_struct<3>>>
+    &pw_pairs_in_contact,
+  const std::unordered_map<
+    types::particle_index,
+    std::map<types::particle_index, pw_contact_info_struct<3>>>
+    &                pfw_pairs_in_contact,
+  const double       rayleigh_time_step_ratio,
+  const double       collision_time_resolution,
+  const unsigned int n_wall_sub_steps,
+  const MPI_Comm &   mpi_communicator);
@@ -0,0 +1,211 @@
+#include <dem/dem_properties.h>
+#include <dem/gear_integrator.h>
+
+using namespace DEM;
+
+template <int dim>
+GearIntegrator<dim>::GearIntegrator(const unsigned int order)
+  : order(order)
+  , n_updates(0)
+  , prediction_time_step(0)
+{
+  if (order == 3)
+    corrector_coefficients = {1. / 6., 5. / 6., 1., 1. / 3.};
+  else if (order == 5)
+    corrector_coefficients = {
+      3. / 20., 251. / 360., 1., 11. / 18., 1. / 6., 1. / 60.};
+  else
+    throw std::runtime_error(
+      "The Gear integrator is only implemented for orders 3 and 5");
+}
+
+template <int dim>
+void
+GearIntegrator<dim>::start_particle_history(
+  const types::particle_index        particle_id,
+  const std::vector<Tensor<1, dim>> &acceleration_derivatives)
+{
+  AssertThrow(acceleration_derivatives.size() + 2 >= order,
+              ExcMessage("The Gear integrator of order " +
+                         std::to_string(order) + " requires " +
+                         std::to_string(order - 2) +
+                         " derivatives of the acceleration"));
+
+  auto &particle_derivatives = initial_derivatives[particle_id];
+  for (unsigned int k = 0; k + 2 < order; ++k)
+    particle_derivatives[k] = acceleration_derivatives[k];
+}
+
+template <int dim>
+void
+GearIntegrator<dim>::integrate_half_step_location(
+  Particles::ParticleHandler<dim> &                          particle_handler,
+  Tensor<1, dim> &                                           g,
+  std::unordered_map<types::particle_index, Tensor<1, dim>> &force,
+  double                                                     dt)
+{
+  history.clear();
+  correct_and_predict(particle_handler, g, force, dt);
+}
+
+template <int dim>
+void
+GearIntegrator<dim>::integrate(
+  Particles::ParticleHandler<dim> &                          particle_handler,
+  Tensor<1, dim> &                                           g,
+  double                                                     dt,
+  std::unordered_map<types::particle_index, Tensor<1, dim>> &momentum,
+  std::unordered_map<types::particle_index, Tensor<1, dim>> &force,
+  std::unordered_map<types::particle_index, double> &        MOI)
+{
+  correct_and_predict(particle_handler, g, force, dt);
+
+  for (auto particle = particle_handler.begin();
+       particle != particle_handler.end();
+       ++particle)
+    {
+      unsigned int    particle_id         = particle->get_id();
+      auto            particle_properties = particle->get_properties();
+      Tensor<1, dim> &particle_momentum   = momentum[particle_id];
+      double          MOI_inverse         = 1 / MOI[particle_id];
+
+      for (int d = 0; d < dim; ++d)
+        {
+          // Updating angular velocity
+          particle_properties[PropertiesIndex::omega_x + d] +=
+            dt * (particle_momentum[d] * MOI_inverse);
+
+          // Reinitializing torque
+          particle_momentum[d] = 0;
+        }
+    }
+}
+
+template <int dim>
+void
+GearIntegrator<dim>::correct_and_predict(
+  Particles::ParticleHandler<dim> &                          particle_handler,
+  const Tensor<1, dim> &                                     g,
+  std::unordered_map<types::particle_index, Tensor<1, dim>> &force,
+  const double                                               dt)
+{
+  // Factors which scale the deviation of the acceleration into the correction
+  // of each derivative of the position, for the time step of the prediction
+  // being corrected: eta_k * dt ^ 2 / 2 * k! / dt ^ k
+  std::array<double, max_n_history + 2> correction{};
+  if (prediction_time_step > 0)
+    {
+      double factor = 0.5 * prediction_time_step * prediction_time_step;
+      for (unsigned int k = 0; k <= order; ++k)
+        {
+          correction[k] = corrector_coefficients[k] * factor;
+          factor *= (k + 1) / prediction_time_step;
+        }
+    }
+
+  // Coefficients of the Taylor expansion of the prediction: dt ^ k / k!
+  std::array<double, max_n_history + 2> taylor;
+  taylor[0] = 1;
+  for (unsigned int k = 1; k <= order; ++k)
+    taylor[k] = taylor[k - 1] * dt / k;
+
+  ++n_updates;
+
+  for (auto particle = particle_handler.begin();
+       particle != particle_handler.end();
+       ++particle)
+    {
+      unsigned int    particle_id         = particle->get_id();
+      auto            particle_properties = particle->get_properties();
+      auto            particle_position   = particle->get_location();
+      Tensor<1, dim> &particle_force      = force[particle_id];
+      double mass_inverse = 1 / particle_properties[PropertiesIndex::mass];
+
+      // The history is started if the particle was not integrated at the
+      // previous call
+      const auto history_it    = history.find(particle_id);
+      const bool start_history = (history_it == history.end() ||
+                                  history_it->second.update + 1 != n_updates);
+
+      ParticleHistory &particle_history = history[particle_id];
+      particle_history.update           = n_updates;
+
+      // The derivatives of the acceleration of a started history are zero,
+      // unless they were given with start_particle_history
+      const auto initial_it = start_history ?
+                                initial_derivatives.find(particle_id) :
+                                initial_derivatives.end();
+      const bool primed     = initial_it != initial_derivatives.end();
+
+      for (int d = 0; d < dim; ++d)
+        {
+          // Position, velocity, acceleration and derivatives of the
+          // acceleration
+          std::array<double, max_n_history + 2> derivatives;
+          derivatives[0] = particle_position[d];
+          derivatives[1] = particle_properties[PropertiesIndex::v_x + d];
+          for (unsigned int k = 2; k <= order; ++k)
+            {
+              if (!start_history)
+                derivatives[k] = particle_history.derivatives[k - 2][d];
+              else if (primed && k > 2)
+                derivatives[k] = initial_it->second[k - 3][d];
+              else
+                derivatives[k] = 0;
+            }
+
+          const double acceleration = g[d] + particle_force[d] * mass_inverse;
+
+          // Corrector
+          if (start_history)
+            derivatives[2] = acceleration;
+          else
+            {
+              const double acceleration_deviation =
+                acceleration - derivatives[2];
+              for (unsigned int k = 0; k <= order; ++k)
+                derivatives[k] += correction[k] * acceleration_deviation;
+            }
+
+          // Predictor
+          for (unsigned int k = 0; k <= order; ++k)
+            {
+              double prediction = 0;
+              for (unsigned int j = k; j <= order; ++j)
+                prediction += taylor[j - k] * derivatives[j];
+
+              if (k == 0)
+                particle_position[d] = prediction;
+              else if (k == 1)
+                particle_properties[PropertiesIndex::v_x + d] = prediction;
+              else
+                particle_history.derivatives[k - 2][d] = prediction;
+            }
+
+          // Reinitializing force
+          particle_force[d] = 0;
+        }
+      particle->set_location(particle_position);
+
+      if (primed)
+        initial_derivatives.erase(initial_it);
+    }
+
+  prediction_time_step = dt;
+
+  // Remove the history of the particles which are no longer owned by this
+  // process
+  if (history.size() > 2 * particle_handler.n_locally_owned_particles())
+    {
+      for (auto it = history.begin(); it != history.end();)
+        {
+          if (it->second.update != n_updates)
+            it = history.erase(it);
+          else
+            ++it;
+        }
+    }
+}
+
+template class GearIntegrator<2>;
+template class GearIntegrator<3>;
@@ -1,3 +1,4 @@
+#include <dem/find_critical_time_step.h>
 #include <dem/find_maximum_particle_size.h>
 #include <dem/input_parameter_inspection.h>
 
@@ -10,27 +11,26 @@ input_parameter_inspection(const DEMSolverParameters<dim> &dem_parameters,
                            const double &standard_deviation_multiplier)
 {
   // Getting the input parameters as local variable
-  auto   parameters          = dem_parameters;
-  auto   physical_properties = dem_parameters.physical_properties;
-  double rayleigh_time_step  = 0;
+  auto   parameters                 = dem_parameters;
+  auto   physical_properties        = dem_parameters.physical_properties;
+  double maximum_rayleigh_time_step = 0;
 
   for (unsigned int i = 0; i < physical_properties.particle_type_number; ++i)
-    rayleigh_time_step =
-      std::max(M_PI_2 * physical_properties.particle_average_diameter[i] *
-                 sqrt(2 * physical_properties.density[i] *
-                      (2 + physical_properties.poisson_ratio_particle[i]) *
-                      (1 - physical_properties.poisson_ratio_particle[i]) /
-                      physical_properties.youngs_modulus_particle[i]) /
-                 (0.1631 * physical_properties.poisson_ratio_particle[i] +
-                  0.8766),
-               rayleigh_time_step);
+    maximum_rayleigh_time_step =
+      std::max(rayleigh_time_step(
+                 physical_properties.particle_average_diameter[i],
+                 physical_properties.density[i],
+                 physical_properties.youngs_modulus_particle[i],
+                 physical_properties.poisson_ratio_particle[i]),
+               maximum_rayleigh_time_step);
 
   const double time_step_rayleigh_ratio =
-    parameters.simulation_control.dt / rayleigh_time_step;
+    parameters.simulation_control.dt / maximum_rayleigh_time_step;
   pcout << "DEM time-step is " << time_step_rayleigh_ratio * 100
         << "% of Rayleigh time step" << std::endl;
 
-  if (time_step_rayleigh_ratio > 0.15)
+  if (time_step_rayleigh_ratio >
+      parameters.model_parameters.rayleigh_time_step_ratio)
     {
       pcout << "Warning: It is recommended to decrease the time-step"
             << std::endl;
@@ -0,0 +1,108 @@
+#include <dem/dem_properties.h>
+#include <dem/multiple_time_step_integrator.h>
+
+using namespace DEM;
+
+template <int dim>
+MultipleTimeStepIntegrator<dim>::MultipleTimeStepIntegrator(
+  const unsigned int n_sub_steps)
+  : n_sub_steps(n_sub_steps)
+{
+  AssertThrow(n_sub_steps > 0,
+              ExcMessage("The number of sub-steps must be positive"));
+}
+
+template <int dim>
+void
+MultipleTimeStepIntegrator<dim>::integrate_slow_forces(
+  Particles::ParticleHandler<dim> &                          particle_handler,
+  const Tensor<1, dim> &                                     body_force,
+  const double                                               time_step,
+  std::unordered_map<types::particle_index, Tensor<1, dim>> &momentum,
+  std::unordered_map<types::particle_index, Tensor<1, dim>> &force,
+  std::unordered_map<types::particle_index, double> &        MOI,
+  const bool                                                 first_step)
+{
+  apply_impulse(particle_handler,
+                body_force,
+                first_step ? 0.5 * time_step : time_step,
+                momentum,
+                force,
+                MOI);
+}
+
+template <int dim>
+void
+MultipleTimeStepIntegrator<dim>::integrate_fast_forces(
+  Particles::ParticleHandler<dim> &                          particle_handler,
+  const double                                               sub_time_step,
+  std::unordered_map<types::particle_index, Tensor<1, dim>> &momentum,
+  std::unordered_map<types::particle_index, Tensor<1, dim>> &force,
+  std::unordered_map<types::particle_index, double> &        MOI,
+  const bool                                                 first_step)
+{
+  apply_impulse(particle_handler,
+                Tensor<1, dim>(),
+                first_step ? 0.5 * sub_time_step : sub_time_step,
+                momentum,
+                force,
+                MOI);
+
+  for (auto particle = particle_handler.begin();
+       particle != particle_handler.end();
+       ++particle)
+    {
+      auto particle_properties = particle->get_properties();
+      auto particle_position   = particle->get_location();
+
+      // Particle location integration
+      for (int d = 0; d < dim; ++d)
+        particle_position[d] +=
+          particle_properties[PropertiesIndex::v_x + d] * sub_time_step;
+
+      particle->set_location(particle_position);
+    }
+}
+
+template <int dim>
+void
+MultipleTimeStepIntegrator<dim>::apply_impulse(
+  Particles::ParticleHandler<dim> &                          particle_handler,
+  const Tensor<1, dim> &                                     body_force,
+  const double                                               impulse_time,
+  std::unordered_map<types::particle_index, Tensor<1, dim>> &momentum,
+  std::unordered_map<types::particle_index, Tensor<1, dim>> &force,
+  std::unordered_map<types::particle_index, double> &        MOI)
+{
+  for (auto particle = particle_handler.begin();
+       particle != particle_handler.end();
+       ++particle)
+    {
+      unsigned int    particle_id         = particle->get_id();
+      auto            particle_properties = particle->get_properties();
+      Tensor<1, dim> &particle_momentum   = momentum[particle_id];
+      Tensor<1, dim> &particle_force      = force[particle_id];
+      double mass_inverse = 1 / particle_properties[PropertiesIndex::mass];
+      double MOI_inverse  = 1 / MOI[particle_id];
+
+      for (int d = 0; d < dim; ++d)
+        {
+          // Particle velocity integration
+          particle_properties[PropertiesIndex::v_x + d] +=
+            impulse_time * (body_force[d] + particle_force[d] * mass_inverse);
+
+          // Updating angular velocity
+          particle_properties[PropertiesIndex::omega_x + d] +=
+            impulse_time * (particle_momentum[d] * MOI_inverse);
+
+          // Reinitializing force
+          particle_force[d] = 0;
+
+          // Reinitializing torque
+          particle_momentum[d] = 0;
+        }
+    }
+}
+
+template class MultipleTimeStepIntegrator<2>;
+template class MultipleTimeStepIntegrator<3>;
@@ -21,12 +21,12 @@
 
 using namespace DEM;
 
-// Updates the contact information (contact_info) based on the new
+// Updates the contact history (contact_history) based on the new
 // information of particles pair in the current time step
 template <int dim>
 void
 PPContactForce<dim>::update_contact_information(
-  pp_contact_info_struct<dim> &  contact_info,
+  pp_contact_history_struct<dim> &contact_history,
   double &                       normal_relative_velocity_value,
   Tensor<1, dim> &               normal_unit_vector,
   const ArrayView<const double> &particle_one_properties,
@@ -97,20 +97,15 @@ PPContactForce<dim>::update_contact_information(
     contact_relative_velocity - normal_relative_velocity;
 
   // Calculation of new tangential_overlap, since this value is
-  // history-dependent it needs the value at previous time-step
-  // This variable is the main reason that we have iteration over
-  // two different vectors (pairs_in_contact and
-  // contact_pair_candidates): tangential_overlap of the particles
-  // which were already in contact (pairs_in_contact) needs to
-  // modified using its history, while the tangential_overlaps of
-  // new particles are equal to zero
+  // history-dependent it needs the value at previous time-step. The
+  // history of the pairs which just came into contact is zero
   Tensor<1, dim> modified_tangential_overlap =
-    contact_info.tangential_overlap +
-    contact_info.tangential_relative_velocity * dt;
+    contact_history.tangential_overlap +
+    contact_history.tangential_relative_velocity * dt;
 
-  // Updating the contact_info container based on the new calculated values
-  contact_info.tangential_overlap           = modified_tangential_overlap;
-  contact_info.tangential_relative_velocity = tangential_relative_velocity;
+  // Updating the contact history based on the new calculated values
+  contact_history.tangential_overlap           = modified_tangential_overlap;
+  contact_history.tangential_relative_velocity = tangential_relative_velocity;
 }
 
 template <int dim>
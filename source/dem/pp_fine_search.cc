@@ -94,17 +94,10 @@ PPFineSearch<dim>::particle_particle_fine_search(
               auto particle_one_contact_list =
                 &local_adjacent_particles[particle_one_id];
 
-              Tensor<1, dim> tangential_overlap;
-              for (int d = 0; d < dim; ++d)
-                {
-                  tangential_overlap[d] = 0;
-                }
-
               // Initilizing the contact info and adding
               pp_contact_info_struct<dim> contact_info;
-              contact_info.tangential_overlap = tangential_overlap;
-              contact_info.particle_one       = particle_one;
-              contact_info.particle_two       = particle_two;
+              contact_info.particle_one = particle_one;
+              contact_info.particle_two = particle_two;
 
               particle_one_contact_list->insert(
                 {particle_two_id, contact_info});
@@ -179,17 +172,10 @@ PPFineSearch<dim>::particle_particle_fine_search(
                 &ghost_adjacent_particles[particle_one->get_id()];
               unsigned int particle_two_id = particle_two->get_id();
 
-              Tensor<1, dim> tangential_overlap;
-              for (int d = 0; d < dim; ++d)
-                {
-                  tangential_overlap[d] = 0;
-                }
-
               // Initilizing the contact info and adding
               pp_contact_info_struct<dim> contact_info;
-              contact_info.tangential_overlap = tangential_overlap;
-              contact_info.particle_one       = particle_one;
-              contact_info.particle_two       = particle_two;
+              contact_info.particle_one = particle_one;
+              contact_info.particle_two = particle_two;
 
               particle_one_contact_list->insert(
                 {particle_two_id, contact_info});
@@ -112,6 +112,10 @@ PPLinearForce<dim>::calculate_pp_contact_force(
   // pairs are different. Consequently, contact forces of local-local and
   // local-ghost particle pairs are performed in separate loops
 
+  // The histories of the pairs in contact are moved to the current histories
+  // in the force loops
+  this->start_contact_histories_update();
+
   // Looping over local_adjacent_particles values with iterator
   // adjacent_particles_list
   for (auto &&adjacent_particles_list :
@@ -141,11 +145,18 @@ PPLinearForce<dim>::calculate_pp_contact_force(
                 {
                   // This means that the adjacent particles are in contact
 
+                  // Getting the ids of the particles and the history of
+                  // their contact
+                  unsigned int particle_one_id = particle_one->get_id();
+                  unsigned int particle_two_id = particle_two->get_id();
+                  pp_contact_history_struct<dim> &contact_history =
+                    this->find_contact_history(contact_info);
+
                   // Since the normal overlap is already calculated we update
                   // this element of the container here. The rest of information
                   // are updated using the following function
                   this->update_contact_information(
-                    contact_info,
+                    contact_history,
                     normal_relative_velocity_value,
                     normal_unit_vector,
                     particle_one_properties,
@@ -155,7 +166,7 @@ PPLinearForce<dim>::calculate_pp_contact_force(
                     dt);
 
                   this->calculate_linear_contact_force_and_torque(
-                    contact_info,
+                    contact_history,
                     normal_relative_velocity_value,
                     normal_unit_vector,
                     normal_overlap,
@@ -167,8 +178,6 @@ PPLinearForce<dim>::calculate_pp_contact_force(
                     rolling_resistance_torque);
 
                   // Getting particles' momentum and force
-                  unsigned int    particle_one_id = particle_one->get_id();
-                  unsigned int    particle_two_id = particle_two->get_id();
                   Tensor<1, dim> &particle_one_momentum =
                     momentum[particle_one_id];
                   Tensor<1, dim> &particle_two_momentum =
@@ -187,15 +196,11 @@ PPLinearForce<dim>::calculate_pp_contact_force(
                                                     particle_one_force,
                                                     particle_two_force);
                 }
-
               else
                 {
-                  // if the adjacent pair is not in contact anymore, only the
-                  // tangential overlap is set to zero
-                  for (int d = 0; d < dim; ++d)
-                    {
-                      contact_info.tangential_overlap[d] = 0;
-                    }
+                  // The history of the pairs which are not in contact
+                  // anymore is dropped
+                  this->expire_contact_history(contact_info);
                 }
             }
         }
@@ -232,11 +237,18 @@ PPLinearForce<dim>::calculate_pp_contact_force(
                 {
                   // This means that the adjacent particles are in contact
 
+                  // Getting the ids of the particles and the history of
+                  // their contact
+                  unsigned int particle_one_id = particle_one->get_id();
+                  unsigned int particle_two_id = particle_two->get_id();
+                  pp_contact_history_struct<dim> &contact_history =
+                    this->find_contact_history(contact_info);
+
                   // Since the normal overlap is already calculated we update
                   // this element of the container here. The rest of information
                   // are updated using the following function
                   this->update_contact_information(
-                    contact_info,
+                    contact_history,
                     normal_relative_velocity_value,
                     normal_unit_vector,
                     particle_one_properties,
@@ -246,7 +258,7 @@ PPLinearForce<dim>::calculate_pp_contact_force(
                     dt);
 
                   this->calculate_linear_contact_force_and_torque(
-                    contact_info,
+                    contact_history,
                     normal_relative_velocity_value,
                     normal_unit_vector,
                     normal_overlap,
@@ -258,7 +270,6 @@ PPLinearForce<dim>::calculate_pp_contact_force(
                     rolling_resistance_torque);
 
                   // Getting momentum and force of particle one
-                  unsigned int    particle_one_id = particle_one->get_id();
                   Tensor<1, dim> &particle_one_momentum =
                     momentum[particle_one_id];
                   Tensor<1, dim> &particle_one_force = force[particle_one_id];
@@ -272,15 +283,11 @@ PPLinearForce<dim>::calculate_pp_contact_force(
                                                      particle_one_momentum,
                                                      particle_one_force);
                 }
-
               else
                 {
-                  // if the adjacent pair is not in contact anymore, only the
-                  // tangential overlap is set to zero
-                  for (int d = 0; d < dim; ++d)
-                    {
-                      contact_info.tangential_overlap[d] = 0;
-                    }
+                  // The history of the pairs which are not in contact
+                  // anymore is dropped
+                  this->expire_contact_history(contact_info);
                 }
             }
         }
@@ -291,16 +298,16 @@ PPLinearForce<dim>::calculate_pp_contact_force(
 template <int dim>
 void
 PPLinearForce<dim>::calculate_linear_contact_force_and_torque(
-  pp_contact_info_struct<dim> &  contact_info,
-  const double &                 normal_relative_velocity_value,
-  const Tensor<1, dim> &         normal_unit_vector,
-  const double &                 normal_overlap,
-  const ArrayView<const double> &particle_one_properties,
-  const ArrayView<const double> &particle_two_properties,
-  Tensor<1, dim> &               normal_force,
-  Tensor<1, dim> &               tangential_force,
-  Tensor<1, dim> &               tangential_torque,
-  Tensor<1, dim> &               rolling_resistance_torque)
+  pp_contact_history_struct<dim> &contact_history,
+  const double &                  normal_relative_velocity_value,
+  const Tensor<1, dim> &          normal_unit_vector,
+  const double &                  normal_overlap,
+  const ArrayView<const double> & particle_one_properties,
+  const ArrayView<const double> & particle_two_properties,
+  Tensor<1, dim> &                normal_force,
+  Tensor<1, dim> &                tangential_force,
+  Tensor<1, dim> &                tangential_torque,
+  Tensor<1, dim> &                rolling_resistance_torque)
 {
   // Calculation of effective radius and mass
   this->find_effective_radius_and_mass(particle_one_properties,
@@ -326,8 +333,8 @@ PPLinearForce<dim>::calculate_linear_contact_force_and_torque(
     1.0667 * sqrt(this->effective_radius) *
       this->effective_youngs_modulus[particle_one_type][particle_two_type] *
       pow((0.9375 * this->effective_mass *
-           contact_info.tangential_relative_velocity *
-           contact_info.tangential_relative_velocity /
+           contact_history.tangential_relative_velocity *
+           contact_history.tangential_relative_velocity /
            (sqrt(this->effective_radius) *
             this->effective_youngs_modulus[particle_one_type]
                                           [particle_two_type])),
@@ -358,9 +365,9 @@ PPLinearForce<dim>::calculate_linear_contact_force_and_torque(
   // forces. Since we need dashpot tangential force in the gross sliding again,
   // we define it as a separate variable
   Tensor<1, dim> dashpot_tangential_force =
-    tangential_damping_constant * contact_info.tangential_relative_velocity;
+    tangential_damping_constant * contact_history.tangential_relative_velocity;
   tangential_force =
-    (tangential_spring_constant * contact_info.tangential_overlap) +
+    (tangential_spring_constant * contact_history.tangential_overlap) +
     dashpot_tangential_force;
 
   double coulomb_threshold =
@@ -374,14 +381,14 @@ PPLinearForce<dim>::calculate_linear_contact_force_and_torque(
     {
       // Gross sliding occurs and the tangential overlap and tangnetial
       // force are limited to Coulumb's criterion
-      contact_info.tangential_overlap =
+      contact_history.tangential_overlap =
         (coulomb_threshold *
            (tangential_force / (tangential_force.norm() + DBL_MIN)) -
          dashpot_tangential_force) /
         (tangential_spring_constant + DBL_MIN);
 
       tangential_force =
-        (tangential_spring_constant * contact_info.tangential_overlap) +
+        (tangential_spring_constant * contact_history.tangential_overlap) +
         dashpot_tangential_force;
     }
 
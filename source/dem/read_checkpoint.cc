@@ -8,6 +8,8 @@ read_checkpoint(TimerOutput &                              computing_timer,
                 const DEMSolverParameters<dim> &           parameters,
                 std::shared_ptr<SimulationControl> &       simulation_control,
                 PVDHandler &                               particles_pvdhandler,
+                std::vector<XDMFEntry> &                   particles_xdmf,
+                std::vector<XDMFEntry> &                   grid_xdmf,
                 parallel::distributed::Triangulation<dim> &triangulation,
                 Particles::ParticleHandler<dim> &          particle_handler)
 {
@@ -15,6 +17,8 @@ read_checkpoint(TimerOutput &                              computing_timer,
   std::string        prefix = parameters.restart.filename;
   simulation_control->read(prefix);
   particles_pvdhandler.read(prefix);
+  read_xdmf_entries(particles_xdmf, prefix + "_particles");
+  read_xdmf_entries(grid_xdmf, prefix + "_grid");
 
   triangulation.signals.post_distributed_load.connect(
     std::bind(&Particles::ParticleHandler<dim>::register_load_callback_function,
@@ -60,6 +64,8 @@ read_checkpoint(TimerOutput &                            computing_timer,
                 const DEMSolverParameters<2> &           parameters,
                 std::shared_ptr<SimulationControl> &     simulation_control,
                 PVDHandler &                             particles_pvdhandler,
+                std::vector<XDMFEntry> &                 particles_xdmf,
+                std::vector<XDMFEntry> &                 grid_xdmf,
                 parallel::distributed::Triangulation<2> &triangulation,
                 Particles::ParticleHandler<2> &          particle_handler);
 
@@ -68,5 +74,7 @@ read_checkpoint(TimerOutput &                            computing_timer,
                 const DEMSolverParameters<3> &           parameters,
                 std::shared_ptr<SimulationControl> &     simulation_control,
                 PVDHandler &                             particles_pvdhandler,
+                std::vector<XDMFEntry> &                 particles_xdmf,
+                std::vector<XDMFEntry> &                 grid_xdmf,
                 parallel::distributed::Triangulation<3> &triangulation,
                 Particles::ParticleHandler<3> &          particle_handler);
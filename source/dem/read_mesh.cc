@@ -1,3 +1,5 @@
+#include <core/grids.h>
+
 #include <dem/read_mesh.h>
 
 template <int dim>
@@ -10,10 +12,9 @@ read_mesh(const DEMSolverParameters<dim> &           parameters,
   // GMSH input
   if (parameters.mesh.type == Parameters::Mesh::Type::gmsh)
     {
-      GridIn<dim> grid_in;
-      grid_in.attach_triangulation(triangulation);
-      std::ifstream input_file(parameters.mesh.file_name);
-      grid_in.read_msh(input_file);
+      read_gmsh_coarse_grid(triangulation,
+                            parameters.mesh,
+                            triangulation.get_communicator());
     }
 
   // Dealii grids
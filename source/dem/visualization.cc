@@ -1,5 +1,7 @@
 #include <dem/visualization.h>
 
+#include <algorithm>
+
 using namespace dealii;
 
 template <int dim>
@@ -9,16 +11,28 @@ Visualization<dim>::Visualization()
 template <int dim>
 void
 Visualization<dim>::build_patches(
-  dealii::Particles::ParticleHandler<dim> &particle_handler,
-  std::vector<std::pair<std::string, int>> properties)
+  dealii::Particles::ParticleHandler<dim> &   particle_handler,
+  std::vector<std::pair<std::string, int>>    properties,
+  const Parameters::Lagrangian::OutputFilter &output_filter)
 {
   // Adding ID to properties vector for visualization
   properties.insert(properties.begin(), std::make_pair("ID", 1));
 
-  // Defining properties for writing
-  this->properties_to_write.assign(properties.begin(),
-                                   properties.begin() +
-                                     DEM::get_number_properties());
+  // Defining properties for writing. The components of a vector property
+  // share the name of the vector, hence they are all selected together
+  std::vector<unsigned int> selected_properties;
+  for (unsigned int property_index = 0; property_index < properties.size();
+       ++property_index)
+    {
+      if (std::find(output_filter.fields.begin(),
+                    output_filter.fields.end(),
+                    properties[property_index].first) !=
+          output_filter.fields.end())
+        {
+          selected_properties.push_back(property_index);
+          this->properties_to_write.push_back(properties[property_index]);
+        }
+    }
 
   // Defining property field position
   int field_position = 0;
@@ -45,35 +59,71 @@ Visualization<dim>::build_patches(
       dataset_names.push_back(field_name);
     }
 
-  // Building the patch data
-  patches.resize(particle_handler.n_locally_owned_particles());
+  // Selecting the particles that are written
+  std::vector<typename dealii::Particles::ParticleHandler<dim>::
+                particle_iterator>
+    particles_to_write;
+  particles_to_write.reserve(particle_handler.n_locally_owned_particles());
 
-  typename dealii::Particles::ParticleHandler<dim>::particle_iterator particle =
-    particle_handler.begin();
+  const Point<3> region_min(output_filter.x_min,
+                            output_filter.y_min,
+                            output_filter.z_min);
+  const Point<3> region_max(output_filter.x_max,
+                            output_filter.y_max,
+                            output_filter.z_max);
+
+  for (auto particle = particle_handler.begin();
+       particle != particle_handler.end();
+       ++particle)
+    {
+      if (particle->get_id() % output_filter.particle_stride != 0)
+        continue;
+
+      if (output_filter.region_filter)
+        {
+          const Point<dim> location      = particle->get_location();
+          bool             inside_region = true;
+          for (unsigned int d = 0; d < dim; ++d)
+            inside_region = inside_region && location[d] >= region_min[d] &&
+                            location[d] <= region_max[d];
+
+          if (!inside_region)
+            continue;
+        }
+
+      particles_to_write.push_back(particle);
+    }
+
+  // Building the patch data
+  patches.resize(particles_to_write.size());
 
   // Looping over particle to get the properties from the particle_handler
-  for (unsigned int i = 0; particle != particle_handler.end(); ++particle, ++i)
+  for (unsigned int i = 0; i < particles_to_write.size(); ++i)
     {
+      const auto &particle = particles_to_write[i];
+
       // Particle location
       patches[i].vertices[0]    = particle->get_location();
       patches[i].patch_index    = i;
       patches[i].n_subdivisions = 1;
-      patches[i].data.reinit(DEM::get_number_properties(), 1);
+      patches[i].data.reinit(selected_properties.size(), 1);
 
       // ID and other properties
       if (particle->has_properties())
         {
-          // Calculating force for visualization
           auto particle_properties = particle->get_properties();
 
-          // Adding ID to patches
-          patches[i].data(0, 0) = particle->get_id();
-
-          for (unsigned int property_index = 1;
-               property_index < DEM::get_number_properties();
-               ++property_index)
-            patches[i].data(property_index, 0) =
-              particle_properties[property_index - 1];
+          for (unsigned int field = 0; field < selected_properties.size();
+               ++field)
+            {
+              // The ID is stored first, followed by the particle properties
+              const unsigned int property_index = selected_properties[field];
+              if (property_index == 0)
+                patches[i].data(field, 0) = particle->get_id();
+              else
+                patches[i].data(field, 0) =
+                  particle_properties[property_index - 1];
+            }
         }
     }
 }
@@ -8,6 +8,8 @@ write_checkpoint(TimerOutput &                       computing_timer,
                  const DEMSolverParameters<dim> &    parameters,
                  std::shared_ptr<SimulationControl> &simulation_control,
                  PVDHandler &                        particles_pvdhandler,
+                 const std::vector<XDMFEntry> &      particles_xdmf,
+                 const std::vector<XDMFEntry> &      grid_xdmf,
                  parallel::distributed::Triangulation<dim> &triangulation,
                  Particles::ParticleHandler<dim> &          particle_handler,
                  const ConditionalOStream &                 pcout,
@@ -22,6 +24,8 @@ write_checkpoint(TimerOutput &                       computing_timer,
     {
       simulation_control->save(prefix);
       particles_pvdhandler.save(prefix);
+      save_xdmf_entries(particles_xdmf, prefix + "_particles");
+      save_xdmf_entries(grid_xdmf, prefix + "_grid");
     }
 
   triangulation.signals.pre_distributed_save.connect(std::bind(
@@ -45,6 +49,8 @@ write_checkpoint(TimerOutput &                            computing_timer,
                  const DEMSolverParameters<2> &           parameters,
                  std::shared_ptr<SimulationControl> &     simulation_control,
                  PVDHandler &                             particles_pvdhandler,
+                 const std::vector<XDMFEntry> &           particles_xdmf,
+                 const std::vector<XDMFEntry> &           grid_xdmf,
                  parallel::distributed::Triangulation<2> &triangulation,
                  Particles::ParticleHandler<2> &          particle_handler,
                  const ConditionalOStream &               pcout,
@@ -55,6 +61,8 @@ write_checkpoint(TimerOutput &                            computing_timer,
                  const DEMSolverParameters<3> &           parameters,
                  std::shared_ptr<SimulationControl> &     simulation_control,
                  PVDHandler &                             particles_pvdhandler,
+                 const std::vector<XDMFEntry> &           particles_xdmf,
+                 const std::vector<XDMFEntry> &           grid_xdmf,
                  parallel::distributed::Triangulation<3> &triangulation,
                  Particles::ParticleHandler<3> &          particle_handler,
                  const ConditionalOStream &               pcout,
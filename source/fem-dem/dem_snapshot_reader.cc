@@ -0,0 +1,186 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2021 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/fe/mapping_q_generic.h>
+
+#include <deal.II/grid/filtered_iterator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <boost/archive/text_iarchive.hpp>
+
+#include <core/grids.h>
+#include <dem/dem_properties.h>
+#include <fem-dem/dem_snapshot_reader.h>
+
+#include <fstream>
+#include <sstream>
+
+template <int dim>
+DEMSnapshotReader<dim>::DEMSnapshotReader(
+  const std::string &                                dem_file_name,
+  const Parameters::Mesh &                           mesh_parameters,
+  const Parameters::Manifolds &                      manifolds_parameters,
+  const BoundaryConditions::BoundaryConditions<dim> &boundary_conditions,
+  const MPI_Comm &                                   mpi_communicator)
+  : dem_file_name(dem_file_name)
+  , mpi_communicator(mpi_communicator)
+  , coarse_triangulation(
+      std::make_shared<parallel::distributed::Triangulation<dim>>(
+        mpi_communicator))
+  , prefetched_index(numbers::invalid_unsigned_int)
+{
+  // The coarse mesh is the same for all the snapshots, it is read once
+  read_mesh_and_manifolds(coarse_triangulation,
+                          mesh_parameters,
+                          manifolds_parameters,
+                          true,
+                          boundary_conditions);
+}
+
+template <int dim>
+DEMSnapshotReader<dim>::~DEMSnapshotReader()
+{
+  // Do not leave a background read running after the reader is destroyed
+  if (prefetched_particles.valid())
+    prefetched_particles.wait();
+}
+
+template <int dim>
+std::string
+DEMSnapshotReader<dim>::snapshot_prefix(const unsigned int index) const
+{
+  return dem_file_name + "." + Utilities::int_to_string(index, 5);
+}
+
+template <int dim>
+void
+DEMSnapshotReader<dim>::prefetch(const unsigned int index)
+{
+  if (prefetched_particles.valid())
+    prefetched_particles.wait();
+
+  prefetched_index     = index;
+  prefetched_particles = std::async(std::launch::async,
+                                    &DEMSnapshotReader<dim>::read_snapshot_files,
+                                    this,
+                                    snapshot_prefix(index));
+}
+
+template <int dim>
+std::string
+DEMSnapshotReader<dim>::read_snapshot_files(const std::string prefix) const
+{
+  // The triangulation is loaded collectively by p4est, reading the files here
+  // only brings them in the file system cache
+  const std::string triangulation_filename = prefix + ".triangulation";
+  const std::vector<std::string> triangulation_files = {
+    triangulation_filename,
+    triangulation_filename + ".info",
+    triangulation_filename + "_fixed.data",
+    triangulation_filename + "_variable.data"};
+
+  std::vector<char> buffer(1 << 20);
+  for (const auto &filename : triangulation_files)
+    {
+      std::ifstream input(filename.c_str(), std::ios::binary);
+      while (input.read(buffer.data(), buffer.size()))
+        {}
+    }
+
+  // Gather particle serialization information
+  std::string   particle_filename = prefix + ".particles";
+  std::ifstream input(particle_filename.c_str());
+  AssertThrow(input, ExcFileNotOpen(particle_filename));
+
+  std::string particles;
+  std::getline(input, particles);
+  return particles;
+}
+
+template <int dim>
+void
+DEMSnapshotReader<dim>::load(
+  const unsigned int                               index,
+  const parallel::distributed::Triangulation<dim> &triangulation,
+  Particles::ParticleHandler<dim> &                particle_handler)
+{
+  std::string particles;
+  if (prefetched_index == index && prefetched_particles.valid())
+    particles = prefetched_particles.get();
+  else
+    particles = read_snapshot_files(snapshot_prefix(index));
+  prefetched_index = numbers::invalid_unsigned_int;
+
+  // The particles of a DEM checkpoint are attached to its triangulation. The
+  // checkpoint is thus loaded in an auxiliary triangulation copied from the
+  // coarse mesh of the fluid triangulation.
+  parallel::distributed::Triangulation<dim> dem_parallel_triangulation(
+    mpi_communicator);
+  dem_parallel_triangulation.copy_triangulation(*coarse_triangulation);
+
+  MappingQGeneric<dim>            dem_mapping(1);
+  Particles::ParticleHandler<dim> dem_particle_handler(
+    dem_parallel_triangulation, dem_mapping, DEM::get_number_properties());
+
+  dem_parallel_triangulation.signals.post_distributed_load.connect(
+    std::bind(&Particles::ParticleHandler<dim>::register_load_callback_function,
+              &dem_particle_handler,
+              true));
+
+  std::istringstream            iss(particles);
+  boost::archive::text_iarchive ia(iss, boost::archive::no_header);
+  ia >> dem_particle_handler;
+
+  const std::string filename = snapshot_prefix(index) + ".triangulation";
+  try
+    {
+      dem_parallel_triangulation.load(filename.c_str());
+    }
+  catch (...)
+    {
+      AssertThrow(false,
+                  ExcMessage("Cannot open DEM snapshot <" + filename +
+                             "> or read the triangulation stored there."));
+    }
+
+  // Insert the particles of the snapshot in the fluid particle handler
+  std::vector<Point<dim>>          particle_locations;
+  std::vector<std::vector<double>> particle_properties;
+  particle_locations.reserve(dem_particle_handler.n_locally_owned_particles());
+  particle_properties.reserve(dem_particle_handler.n_locally_owned_particles());
+
+  for (auto &particle : dem_particle_handler)
+    {
+      particle_locations.push_back(particle.get_location());
+      const auto properties = particle.get_properties();
+      particle_properties.emplace_back(properties.begin(), properties.end());
+    }
+
+  const auto my_bounding_box = GridTools::compute_mesh_predicate_bounding_box(
+    triangulation, IteratorFilters::LocallyOwnedCell());
+  const auto global_bounding_boxes =
+    Utilities::MPI::all_gather(mpi_communicator, my_bounding_box);
+
+  particle_handler.clear_particles();
+  particle_handler.insert_global_particles(particle_locations,
+                                           global_bounding_boxes,
+                                           particle_properties);
+}
+
+template class DEMSnapshotReader<2>;
+template class DEMSnapshotReader<3>;
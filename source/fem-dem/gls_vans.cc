@@ -10,7 +10,28 @@ GLSVANSSolver<dim>::GLSVANSSolver(SimulationParameters<dim> &p_nsparam)
   , particle_handler(*this->triangulation,
                      particle_mapping,
                      DEM::get_number_properties())
-{}
+  , dem_snapshot_index(numbers::invalid_unsigned_int)
+{
+  if (this->simulation_parameters.void_fraction->dem_time_series)
+    {
+      AssertThrow(
+        this->simulation_parameters.void_fraction->mode ==
+            Parameters::VoidFractionMode::dem &&
+          this->simulation_parameters.void_fraction->read_dem,
+        ExcMessage(
+          "A DEM time series requires the dem void fraction mode and read dem = true"));
+      AssertThrow(this->simulation_parameters.void_fraction
+                      ->dem_time_series_size > 0,
+                  ExcMessage("A DEM time series requires at least one file"));
+
+      dem_snapshot_reader = std::make_shared<DEMSnapshotReader<dim>>(
+        this->simulation_parameters.void_fraction->dem_file_name,
+        this->simulation_parameters.mesh,
+        this->simulation_parameters.manifolds_parameters,
+        this->simulation_parameters.boundary_conditions,
+        this->mpi_communicator);
+    }
+}
 
 template <int dim>
 GLSVANSSolver<dim>::~GLSVANSSolver()
@@ -74,6 +95,20 @@ GLSVANSSolver<dim>::setup_dofs()
 
   system_rhs_void_fraction.reinit(locally_owned_dofs_voidfraction,
                                   this->mpi_communicator);
+
+  if (dem_snapshot_reader)
+    {
+      void_fraction_snapshot_previous.reinit(locally_owned_dofs_voidfraction,
+                                             locally_relevant_dofs_voidfraction,
+                                             this->mpi_communicator);
+      void_fraction_snapshot_next.reinit(locally_owned_dofs_voidfraction,
+                                         locally_relevant_dofs_voidfraction,
+                                         this->mpi_communicator);
+
+      // The void fraction of the snapshots has to be recalculated on the new
+      // degrees of freedom
+      dem_snapshot_index = numbers::invalid_unsigned_int;
+    }
 }
 
 template <int dim>
@@ -95,7 +130,11 @@ GLSVANSSolver<dim>::read_dem()
     dynamic_cast<parallel::distributed::Triangulation<dim> *>(
       &*this->triangulation);
 
-  std::string prefix = this->simulation_parameters.void_fraction->dem_file_name;
+  // The fluid triangulation is loaded from the first snapshot of a time series
+  std::string prefix =
+    dem_snapshot_reader ?
+      dem_snapshot_reader->snapshot_prefix(0) :
+      this->simulation_parameters.void_fraction->dem_file_name;
 
   parallel_triangulation->signals.post_distributed_load.connect(
     std::bind(&Particles::ParticleHandler<dim>::register_load_callback_function,
@@ -178,11 +217,101 @@ GLSVANSSolver<dim>::calculate_void_fraction(const double time)
   else if (this->simulation_parameters.void_fraction->mode ==
            Parameters::VoidFractionMode::dem)
     {
-      assemble_L2_projection_void_fraction();
-      solve_L2_system_void_fraction();
+      if (dem_snapshot_reader)
+        {
+          update_dem_snapshots(time);
+          interpolate_snapshots_void_fraction(time);
+        }
+      else
+        {
+          assemble_L2_projection_void_fraction();
+          solve_L2_system_void_fraction();
+        }
     }
 }
 
+template <int dim>
+void
+GLSVANSSolver<dim>::update_dem_snapshots(const double time)
+{
+  const unsigned int n_snapshots =
+    this->simulation_parameters.void_fraction->dem_time_series_size;
+  const double period =
+    this->simulation_parameters.void_fraction->dem_time_series_period;
+
+  // Index of the snapshot that precedes the current time. The void fraction
+  // of the last snapshot is kept once the time series is exhausted.
+  const unsigned int index =
+    std::min(static_cast<unsigned int>(std::max(0., time / period + 1e-12)),
+             n_snapshots - 1);
+
+  if (index == dem_snapshot_index)
+    return;
+
+  TimerOutput::Scope t(this->computing_timer, "load_dem_snapshot");
+
+  // When advancing by a single snapshot, the next snapshot becomes the
+  // previous one and only the new next snapshot has to be loaded
+  if (dem_snapshot_index != numbers::invalid_unsigned_int &&
+      index == dem_snapshot_index + 1)
+    void_fraction_snapshot_previous = void_fraction_snapshot_next;
+  else
+    calculate_snapshot_void_fraction(index, void_fraction_snapshot_previous);
+
+  const unsigned int next_index = std::min(index + 1, n_snapshots - 1);
+  if (next_index == index)
+    void_fraction_snapshot_next = void_fraction_snapshot_previous;
+  else
+    calculate_snapshot_void_fraction(next_index, void_fraction_snapshot_next);
+
+  dem_snapshot_index = index;
+
+  // Read the files of the following snapshot while the fluid is solved
+  if (next_index + 1 < n_snapshots)
+    dem_snapshot_reader->prefetch(next_index + 1);
+}
+
+template <int dim>
+void
+GLSVANSSolver<dim>::calculate_snapshot_void_fraction(
+  const unsigned int             index,
+  TrilinosWrappers::MPI::Vector &snapshot_void_fraction)
+{
+  this->pcout << "Loading DEM snapshot "
+              << dem_snapshot_reader->snapshot_prefix(index) << std::endl;
+
+  dem_snapshot_reader->load(
+    index,
+    *dynamic_cast<parallel::distributed::Triangulation<dim> *>(
+      this->triangulation.get()),
+    particle_handler);
+
+  assemble_L2_projection_void_fraction();
+  solve_L2_system_void_fraction();
+  snapshot_void_fraction = nodal_void_fraction_relevant;
+}
+
+template <int dim>
+void
+GLSVANSSolver<dim>::interpolate_snapshots_void_fraction(const double time)
+{
+  const double period =
+    this->simulation_parameters.void_fraction->dem_time_series_period;
+
+  // Weight of the next snapshot, the void fraction is held constant past the
+  // last snapshot
+  const double theta =
+    std::max(0., std::min(1., time / period - dem_snapshot_index));
+
+  for (const auto j : void_fraction_dof_handler.locally_owned_dofs())
+    nodal_void_fraction_owned[j] =
+      (1. - theta) * void_fraction_snapshot_previous[j] +
+      theta * void_fraction_snapshot_next[j];
+
+  nodal_void_fraction_owned.compress(VectorOperation::insert);
+  nodal_void_fraction_relevant = nodal_void_fraction_owned;
+}
+
 template <int dim>
 void
 GLSVANSSolver<dim>::assemble_L2_projection_void_fraction()
@@ -425,6 +554,7 @@ GLSVANSSolver<dim>::first_iteration()
 
       PhysicsSolver<TrilinosWrappers::MPI::Vector>::solve_non_linear_system(
         Parameters::SimulationControl::TimeSteppingMethod::bdf1, false, true);
+      this->solution_m4 = this->solution_m3;
       this->solution_m3 = this->solution_m2;
       this->solution_m2 = this->solution_m1;
       this->solution_m1 = this->present_solution;
@@ -457,6 +587,7 @@ GLSVANSSolver<dim>::iterate()
   calculate_void_fraction(this->simulation_control->get_current_time());
   this->forcing_function->set_time(
     this->simulation_control->get_current_time());
+  this->extrapolate_initial_guess();
   PhysicsSolver<TrilinosWrappers::MPI::Vector>::solve_non_linear_system(
     this->simulation_parameters.simulation_control.method, false, false);
 }
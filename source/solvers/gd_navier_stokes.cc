@@ -586,6 +586,9 @@ GDNavierStokesSolver<dim>::setup_dofs_fd()
   this->solution_m3.reinit(this->locally_owned_dofs,
                            this->locally_relevant_dofs,
                            this->mpi_communicator);
+  this->solution_m4.reinit(this->locally_owned_dofs,
+                           this->locally_relevant_dofs,
+                           this->mpi_communicator);
   this->newton_update.reinit(this->locally_owned_dofs, this->mpi_communicator);
   this->system_rhs.reinit(this->locally_owned_dofs, this->mpi_communicator);
   this->local_evaluation_point.reinit(this->locally_owned_dofs,
@@ -743,6 +746,8 @@ GDNavierStokesSolver<dim>::solve_linear_system(const bool initial_step,
                      renewed_matrix);
   else
     throw(std::runtime_error("This solver is not allowed"));
+
+  this->print_pending_memory_usage();
 }
 
 template <int dim>
@@ -750,6 +755,7 @@ void
 GDNavierStokesSolver<dim>::setup_ILU()
 {
   TimerOutput::Scope t(this->computing_timer, "setup_ILU");
+  Timer              timer;
 
   //**********************************************
   // Trillinos Wrapper ILU Preconditioner
@@ -782,6 +788,8 @@ GDNavierStokesSolver<dim>::setup_ILU()
     &(*velocity_ilu_preconditioner),
     &(*pressure_ilu_preconditioner),
     this->simulation_parameters.linear_solver);
+
+  this->get_telemetry().add_preconditioner_setup(timer.wall_time());
 }
 
 template <int dim>
@@ -789,6 +797,7 @@ void
 GDNavierStokesSolver<dim>::setup_AMG()
 {
   TimerOutput::Scope t(this->computing_timer, "setup_AMG");
+  Timer              timer;
 
   //**********************************************
   // Trillinos Wrapper AMG Preconditioner
@@ -897,10 +906,33 @@ GDNavierStokesSolver<dim>::setup_AMG()
     &(*velocity_amg_preconditioner),
     &(*pressure_amg_preconditioner),
     this->simulation_parameters.linear_solver);
+
+  this->get_telemetry().add_preconditioner_setup(timer.wall_time());
 }
 
 
 
+template <int dim>
+void
+GDNavierStokesSolver<dim>::add_linear_system_memory_usage(
+  MemoryReport &report) const
+{
+  report.add_entry("System matrix",
+                   system_matrix.memory_consumption() +
+                     pressure_mass_matrix.memory_consumption());
+
+  std::size_t preconditioner_memory = 0;
+  for (const auto &preconditioner :
+       {velocity_ilu_preconditioner, pressure_ilu_preconditioner})
+    if (preconditioner)
+      preconditioner_memory += ilu_memory_consumption(*preconditioner);
+  for (const auto &preconditioner :
+       {velocity_amg_preconditioner, pressure_amg_preconditioner})
+    if (preconditioner)
+      preconditioner_memory += preconditioner->memory_consumption();
+  report.add_entry("Preconditioner", preconditioner_memory);
+}
+
 template <int dim>
 void
 GDNavierStokesSolver<dim>::solve_system_GMRES(const bool   initial_step,
@@ -942,6 +974,7 @@ GDNavierStokesSolver<dim>::solve_system_GMRES(const bool   initial_step,
                  this->newton_update,
                  this->system_rhs,
                  *system_ilu_preconditioner);
+    this->get_telemetry().add_linear_solve(solver_control.last_step());
     if (this->simulation_parameters.linear_solver.verbosity !=
         Parameters::Verbosity::quiet)
       {
@@ -997,6 +1030,7 @@ GDNavierStokesSolver<dim>::solve_system_AMG(const bool   initial_step,
                  this->newton_update,
                  this->system_rhs,
                  *system_amg_preconditioner);
+    this->get_telemetry().add_linear_solve(solver_control.last_step());
     if (this->simulation_parameters.linear_solver.verbosity !=
         Parameters::Verbosity::quiet)
       {
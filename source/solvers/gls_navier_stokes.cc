@@ -202,6 +202,9 @@ GLSNavierStokesSolver<dim>::setup_dofs_fd()
   this->solution_m3.reinit(this->locally_owned_dofs,
                            this->locally_relevant_dofs,
                            this->mpi_communicator);
+  this->solution_m4.reinit(this->locally_owned_dofs,
+                           this->locally_relevant_dofs,
+                           this->mpi_communicator);
 
   this->newton_update.reinit(this->locally_owned_dofs, this->mpi_communicator);
   this->system_rhs.reinit(this->locally_owned_dofs, this->mpi_communicator);
@@ -1267,6 +1270,8 @@ GLSNavierStokesSolver<dim>::solve_linear_system(const bool initial_step,
                         renewed_matrix);
   else
     throw(std::runtime_error("This solver is not allowed"));
+
+  this->print_pending_memory_usage();
 }
 
 template <int dim>
@@ -1274,6 +1279,7 @@ void
 GLSNavierStokesSolver<dim>::setup_ILU()
 {
   TimerOutput::Scope t(this->computing_timer, "setup_ILU");
+  Timer              timer;
 
   const double ilu_fill =
     this->simulation_parameters.linear_solver.ilu_precond_fill;
@@ -1287,6 +1293,8 @@ GLSNavierStokesSolver<dim>::setup_ILU()
   ilu_preconditioner = std::make_shared<TrilinosWrappers::PreconditionILU>();
 
   ilu_preconditioner->initialize(system_matrix, preconditionerOptions);
+
+  this->get_telemetry().add_preconditioner_setup(timer.wall_time());
 }
 
 template <int dim>
@@ -1294,6 +1302,7 @@ void
 GLSNavierStokesSolver<dim>::setup_AMG()
 {
   TimerOutput::Scope t(this->computing_timer, "setup_AMG");
+  Timer              timer;
 
   std::vector<std::vector<bool>> constant_modes;
   // Constant modes include pressure since everything is in the same matrix
@@ -1355,6 +1364,23 @@ GLSNavierStokesSolver<dim>::setup_AMG()
   parameter_ml.set("coarse: ifpack relative threshold", ilu_rtol);
   amg_preconditioner = std::make_shared<TrilinosWrappers::PreconditionAMG>();
   amg_preconditioner->initialize(system_matrix, parameter_ml);
+
+  this->get_telemetry().add_preconditioner_setup(timer.wall_time());
+}
+
+template <int dim>
+void
+GLSNavierStokesSolver<dim>::add_linear_system_memory_usage(
+  MemoryReport &report) const
+{
+  report.add_entry("System matrix", system_matrix.memory_consumption());
+
+  std::size_t preconditioner_memory = 0;
+  if (ilu_preconditioner)
+    preconditioner_memory += ilu_memory_consumption(*ilu_preconditioner);
+  if (amg_preconditioner)
+    preconditioner_memory += amg_preconditioner->memory_consumption();
+  report.add_entry("Preconditioner", preconditioner_memory);
 }
 
 template <int dim>
@@ -1424,6 +1450,8 @@ GLSNavierStokesSolver<dim>::solve_system_GMRES(const bool   initial_step,
                          system_rhs,
                          *ilu_preconditioner);
 
+            this->get_telemetry().add_linear_solve(solver_control.last_step());
+
             if (this->simulation_parameters.linear_solver.verbosity !=
                 Parameters::Verbosity::quiet)
               {
@@ -1440,6 +1468,7 @@ GLSNavierStokesSolver<dim>::solve_system_GMRES(const bool   initial_step,
       catch (std::exception &e)
         {
           this->simulation_parameters.linear_solver.ilu_precond_fill += 1;
+          this->get_telemetry().add_fill_increase();
           this->pcout
             << " GMRES solver failed! Trying with higher preconditioner fill level. New fill = "
             << this->simulation_parameters.linear_solver.ilu_precond_fill
@@ -1495,6 +1524,8 @@ GLSNavierStokesSolver<dim>::solve_system_BiCGStab(
                  system_rhs,
                  *ilu_preconditioner);
 
+    this->get_telemetry().add_linear_solve(solver_control.last_step());
+
     if (this->simulation_parameters.linear_solver.verbosity !=
         Parameters::Verbosity::quiet)
       {
@@ -1552,6 +1583,8 @@ GLSNavierStokesSolver<dim>::solve_system_AMG(const bool   initial_step,
                  system_rhs,
                  *amg_preconditioner);
 
+    this->get_telemetry().add_linear_solve(solver_control.last_step());
+
     if (this->simulation_parameters.linear_solver.verbosity !=
         Parameters::Verbosity::quiet)
       {
@@ -1642,6 +1675,8 @@ GLSNavierStokesSolver<dim>::solve_system_TFQMR(const bool   initial_step,
                  system_rhs,
                  *ilu_preconditioner);
 
+    this->get_telemetry().add_linear_solve(solver_control.last_step());
+
     if (this->simulation_parameters.linear_solver.verbosity !=
         Parameters::Verbosity::quiet)
       {
@@ -59,6 +59,120 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::GLSNitscheNavierStokesSolver(
 
   solid_forces_table.resize(n_solids);
   solid_torques_table.resize(n_solids);
+
+  // Weight the fluid cells containing solid particles when the fluid
+  // triangulation is repartitioned, so that the cost of the Nitsche
+  // restriction is balanced between the processes
+  if (this->simulation_parameters.nitsche->particle_weight > 0)
+    if (auto fluid_tria =
+          dynamic_cast<parallel::distributed::Triangulation<spacedim> *>(
+            this->triangulation.get()))
+      fluid_tria->signals.cell_weight.connect(
+        [&](const typename parallel::distributed::Triangulation<
+              spacedim>::cell_iterator &cell,
+            const typename parallel::distributed::Triangulation<
+              spacedim>::CellStatus status) -> unsigned int {
+          return this->cell_weight(cell, status);
+        });
+}
+
+template <int dim, int spacedim>
+unsigned int
+GLSNitscheNavierStokesSolver<dim, spacedim>::cell_weight(
+  const typename parallel::distributed::Triangulation<spacedim>::cell_iterator
+    &cell,
+  const typename parallel::distributed::Triangulation<spacedim>::CellStatus
+    status) const
+{
+  unsigned int n_particles_in_cell = 0;
+  for (unsigned int i_solid = 0; i_solid < solid.size(); ++i_solid)
+    {
+      // The particles of the solid are only created at the beginning of the
+      // simulation
+      const auto &particle_handler =
+        solid[i_solid]->get_solid_particle_handler();
+      if (particle_handler == nullptr)
+        continue;
+
+      if (status ==
+            parallel::distributed::Triangulation<spacedim>::CELL_PERSIST ||
+          status == parallel::distributed::Triangulation<spacedim>::CELL_REFINE)
+        n_particles_in_cell += particle_handler->n_particles_in_cell(cell);
+      else if (status ==
+               parallel::distributed::Triangulation<spacedim>::CELL_COARSEN)
+        {
+          for (unsigned int child_index = 0;
+               child_index < GeometryInfo<spacedim>::max_children_per_cell;
+               ++child_index)
+            n_particles_in_cell +=
+              particle_handler->n_particles_in_cell(cell->child(child_index));
+        }
+    }
+
+  return n_particles_in_cell *
+         this->simulation_parameters.nitsche->particle_weight;
+}
+
+template <int dim, int spacedim>
+void
+GLSNitscheNavierStokesSolver<dim, spacedim>::tabulate_nitsche_cell_values(
+  const typename Particles::ParticleHandler<spacedim>::particle_iterator_range
+    &                                         pic,
+  const std::vector<types::global_dof_index> &fluid_dof_indices,
+  Function<spacedim> *                        solid_velocity,
+  NitscheCellValues<spacedim> &               cell_values)
+{
+  const unsigned int dofs_per_cell = this->fe->dofs_per_cell;
+
+  // The component of the dofs only depends on the fluid element, it is thus
+  // only identified once
+  if (velocity_component_dofs.empty())
+    {
+      velocity_component_dofs.resize(spacedim);
+      for (unsigned int k = 0; k < dofs_per_cell; ++k)
+        {
+          const auto comp_k = this->fe->system_to_component_index(k).first;
+          if (comp_k < spacedim)
+            velocity_component_dofs[comp_k].push_back(k);
+        }
+    }
+
+  std::vector<Point<spacedim>> reference_locations;
+  cell_values.locations.clear();
+  cell_values.JxW.clear();
+  for (const auto &p : pic)
+    {
+      reference_locations.push_back(p.get_reference_location());
+      cell_values.locations.push_back(p.get_location());
+      cell_values.JxW.push_back(p.get_properties()[0]);
+    }
+  const unsigned int n_points = cell_values.locations.size();
+
+  // Gather the velocity dofs of the cell once for all the particles
+  auto &                 evaluation_point = this->evaluation_point;
+  dealii::Vector<double> local_velocity(dofs_per_cell);
+  for (unsigned int comp = 0; comp < spacedim; ++comp)
+    for (const unsigned int k : velocity_component_dofs[comp])
+      local_velocity[k] = evaluation_point[fluid_dof_indices[k]];
+
+  // Get the velocity at non-quadrature points (particles in fluid)
+  cell_values.shape_values.reinit(n_points, dofs_per_cell);
+  cell_values.fluid_velocity.assign(n_points, Tensor<1, spacedim>());
+  for (unsigned int q = 0; q < n_points; ++q)
+    for (unsigned int comp = 0; comp < spacedim; ++comp)
+      for (const unsigned int k : velocity_component_dofs[comp])
+        {
+          const double phi_k = this->fe->shape_value(k, reference_locations[q]);
+          cell_values.shape_values(q, k) = phi_k;
+          cell_values.fluid_velocity[q][comp] += local_velocity[k] * phi_k;
+        }
+
+  // Evaluate the solid velocity at all the particles in a single call
+  cell_values.solid_velocity.resize(n_points);
+  for (auto &solid_velocity_value : cell_values.solid_velocity)
+    solid_velocity_value.reinit(solid_velocity->n_components);
+  solid_velocity->vector_value_list(cell_values.locations,
+                                    cell_values.solid_velocity);
 }
 
 template <int dim, int spacedim>
@@ -81,9 +195,10 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::assemble_nitsche_restriction()
       FullMatrix<double>     local_matrix(dofs_per_cell, dofs_per_cell);
       dealii::Vector<double> local_rhs(dofs_per_cell);
 
-      Tensor<1, spacedim> velocity;
       Function<spacedim> *solid_velocity = solid[i_solid]->get_solid_velocity();
 
+      NitscheCellValues<spacedim> cell_values;
+
       // Penalization terms
       const double beta = this->simulation_parameters.nitsche->beta;
 
@@ -112,52 +227,34 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::assemble_nitsche_restriction()
 
           const auto pic = solid_ph->particles_in_cell(cell);
           Assert(pic.begin() == particle, ExcInternalError());
-          for (const auto &p : pic)
-            {
-              velocity           = 0;
-              const auto &ref_q  = p.get_reference_location();
-              const auto &real_q = p.get_location();
-              const auto &JxW    = p.get_properties()[0];
+          tabulate_nitsche_cell_values(pic,
+                                       fluid_dof_indices,
+                                       solid_velocity,
+                                       cell_values);
 
-              for (unsigned int k = 0; k < dofs_per_cell; ++k)
-                {
-                  const auto comp_k =
-                    this->fe->system_to_component_index(k).first;
-                  if (comp_k < spacedim)
-                    {
-                      // Get the velocity at non-quadrature point (particle in
-                      // fluid)
-                      auto &evaluation_point = this->evaluation_point;
-                      velocity[comp_k] +=
-                        evaluation_point[fluid_dof_indices[k]] *
-                        this->fe->shape_value(k, ref_q);
-                    }
-                }
-              for (unsigned int i = 0; i < dofs_per_cell; ++i)
+          const double penalty = penalty_parameter * beta;
+          for (unsigned int q = 0; q < cell_values.JxW.size(); ++q)
+            {
+              for (unsigned int comp = 0; comp < spacedim; ++comp)
                 {
-                  const auto comp_i =
-                    this->fe->system_to_component_index(i).first;
-                  if (comp_i < spacedim)
+                  const double velocity_difference =
+                    cell_values.solid_velocity[q][comp] -
+                    cell_values.fluid_velocity[q][comp];
+
+                  for (const unsigned int i : velocity_component_dofs[comp])
                     {
+                      const double phi_i_JxW = penalty *
+                                               cell_values.shape_values(q, i) *
+                                               cell_values.JxW[q];
+
                       if (assemble_matrix)
                         {
-                          for (unsigned int j = 0; j < dofs_per_cell; ++j)
-                            {
-                              const auto comp_j =
-                                this->fe->system_to_component_index(j).first;
-                              if (comp_i == comp_j)
-                                local_matrix(i, j) +=
-                                  penalty_parameter * beta *
-                                  this->fe->shape_value(i, ref_q) *
-                                  this->fe->shape_value(j, ref_q) * JxW;
-                            }
+                          for (const unsigned int j :
+                               velocity_component_dofs[comp])
+                            local_matrix(i, j) +=
+                              phi_i_JxW * cell_values.shape_values(q, j);
                         }
-                      local_rhs(i) += -penalty_parameter * beta *
-                                        velocity[comp_i] *
-                                        this->fe->shape_value(i, ref_q) * JxW +
-                                      penalty_parameter * beta *
-                                        solid_velocity->value(real_q, comp_i) *
-                                        this->fe->shape_value(i, ref_q) * JxW;
+                      local_rhs(i) += phi_i_JxW * velocity_difference;
                     }
                 }
             }
@@ -267,9 +364,11 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::calculate_forces_on_solid(
 
   // Penalization terms
   const double        beta = this->simulation_parameters.nitsche->beta;
-  Tensor<1, spacedim> velocity;
   Function<spacedim> *solid_velocity = solid[i_solid]->get_solid_velocity();
   Tensor<1, spacedim> force;
+
+  NitscheCellValues<spacedim> cell_values;
+
   for (unsigned int i = 0; i < spacedim; ++i)
     force[i] = 0;
 
@@ -292,35 +391,23 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::calculate_forces_on_solid(
 
       const auto pic = solid_ph->particles_in_cell(cell);
       Assert(pic.begin() == particle, ExcInternalError());
-      for (const auto &p : pic)
-        {
-          velocity           = 0;
-          const auto &ref_q  = p.get_reference_location();
-          const auto &real_q = p.get_location();
-          const auto &JxW    = p.get_properties()[0];
+      tabulate_nitsche_cell_values(pic,
+                                   fluid_dof_indices,
+                                   solid_velocity,
+                                   cell_values);
 
-          for (unsigned int k = 0; k < dofs_per_cell; ++k)
-            {
-              const auto comp_k = this->fe->system_to_component_index(k).first;
-              if (comp_k < spacedim)
-                {
-                  // Get the velocity at non-quadrature point (particle in
-                  // fluid)
-                  auto &evaluation_point = this->evaluation_point;
-                  velocity[comp_k] += evaluation_point[fluid_dof_indices[k]] *
-                                      this->fe->shape_value(k, ref_q);
-                }
-            }
-          for (unsigned int i = 0; i < dofs_per_cell; ++i)
+      for (unsigned int q = 0; q < cell_values.JxW.size(); ++q)
+        {
+          for (unsigned int comp = 0; comp < spacedim; ++comp)
             {
-              const auto comp_i = this->fe->system_to_component_index(i).first;
-              if (comp_i < spacedim)
-                {
-                  force[comp_i] +=
-                    penalty_parameter * beta * this->fe->shape_value(i, ref_q) *
-                    JxW *
-                    (solid_velocity->value(real_q, comp_i) - velocity[comp_i]);
-                }
+              const double velocity_difference =
+                cell_values.solid_velocity[q][comp] -
+                cell_values.fluid_velocity[q][comp];
+
+              for (const unsigned int i : velocity_component_dofs[comp])
+                force[comp] += penalty_parameter * beta *
+                               cell_values.shape_values(q, i) *
+                               cell_values.JxW[q] * velocity_difference;
             }
         }
       particle = pic.end();
@@ -343,9 +430,9 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::calculate_torque_on_solid(
 
   // Penalization terms
   const double        beta = this->simulation_parameters.nitsche->beta;
-  Tensor<1, spacedim> velocity;
   Function<spacedim> *solid_velocity = solid[i_solid]->get_solid_velocity();
 
+  NitscheCellValues<spacedim> cell_values;
 
   Tensor<1, 3> torque;
   torque = 0;
@@ -373,40 +460,28 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::calculate_torque_on_solid(
 
       const auto pic = solid_ph->particles_in_cell(cell);
       Assert(pic.begin() == particle, ExcInternalError());
-      for (const auto &p : pic)
+      tabulate_nitsche_cell_values(pic,
+                                   fluid_dof_indices,
+                                   solid_velocity,
+                                   cell_values);
+
+      for (unsigned int q = 0; q < cell_values.JxW.size(); ++q)
         {
           Tensor<1, spacedim> force;
-          force              = 0;
-          velocity           = 0;
-          const auto &ref_q  = p.get_reference_location();
-          const auto &real_q = p.get_location();
-          const auto &JxW    = p.get_properties()[0];
-
-          for (unsigned int k = 0; k < dofs_per_cell; ++k)
+          for (unsigned int comp = 0; comp < spacedim; ++comp)
             {
-              const auto comp_k = this->fe->system_to_component_index(k).first;
-              if (comp_k < spacedim)
-                {
-                  // Get the velocity at non-quadrature point (particle in
-                  // fluid)
-                  auto &evaluation_point = this->evaluation_point;
-                  velocity[comp_k] += evaluation_point[fluid_dof_indices[k]] *
-                                      this->fe->shape_value(k, ref_q);
-                }
-            }
-          for (unsigned int i = 0; i < dofs_per_cell; ++i)
-            {
-              const auto comp_i = this->fe->system_to_component_index(i).first;
-              if (comp_i < spacedim)
-                {
-                  force[comp_i] +=
-                    penalty_parameter * beta * this->fe->shape_value(i, ref_q) *
-                    JxW *
-                    (solid_velocity->value(real_q, comp_i) - velocity[comp_i]);
-                }
+              const double velocity_difference =
+                cell_values.solid_velocity[q][comp] -
+                cell_values.fluid_velocity[q][comp];
+
+              for (const unsigned int i : velocity_component_dofs[comp])
+                force[comp] += penalty_parameter * beta *
+                               cell_values.shape_values(q, i) *
+                               cell_values.JxW[q] * velocity_difference;
             }
+
           // Calculate torque on particle location
-          auto distance = real_q - center_of_rotation;
+          auto distance = cell_values.locations[q] - center_of_rotation;
 
           if (dim == 2)
             {
@@ -638,14 +713,16 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::solve()
                   ->enable_particles_motion)
               {
                 solid[i_solid]->integrate_velocity(
-                  this->simulation_control->get_time_step());
+                  this->simulation_control->get_time_step(),
+                  this->simulation_control->get_previous_time());
                 // (known issue) Full load of the solid triangulation is not
                 // currently supported if the simulation is restarted, so the
                 // solid triangulation will not be moved in this case
                 if (!this->simulation_parameters.restart_parameters.restart)
                   {
                     solid[i_solid]->move_solid_triangulation(
-                      this->simulation_control->get_time_step());
+                      this->simulation_control->get_time_step(),
+                      this->simulation_control->get_previous_time());
                   }
               }
           }
@@ -788,6 +865,7 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::write_checkpoint()
       this->simulation_control->save(prefix);
       // Navier-Stokes
       this->pvdhandler.save(prefix);
+      save_xdmf_entries(this->xdmf_entries, prefix);
       // Nitche
       for (unsigned int i_solid = 0; i_solid < solid.size(); ++i_solid)
         {
@@ -873,6 +951,7 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::read_checkpoint()
 
   // Load Paraview data file for the fluid
   this->pvdhandler.read(prefix);
+  read_xdmf_entries(this->xdmf_entries, prefix);
 
   for (unsigned int i_solid = 0; i_solid < nb_solid; ++i_solid)
     {
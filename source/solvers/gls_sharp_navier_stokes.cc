@@ -30,7 +30,21 @@ template <int dim>
 GLSSharpNavierStokesSolver<dim>::GLSSharpNavierStokesSolver(
   SimulationParameters<dim> &p_nsparam)
   : GLSNavierStokesSolver<dim>(p_nsparam)
-{}
+{
+  // Weight the cells cut by the particles when the triangulation is
+  // repartitioned, so that the cost of the sharp edge is balanced between the
+  // processes
+  if (this->simulation_parameters.particlesParameters.cut_cell_weight > 0)
+    if (auto tria = dynamic_cast<parallel::distributed::Triangulation<dim> *>(
+          this->triangulation.get()))
+      tria->signals.cell_weight.connect(
+        [&](const typename parallel::distributed::Triangulation<
+              dim>::cell_iterator &cell,
+            const typename parallel::distributed::Triangulation<dim>::CellStatus
+              status) -> unsigned int {
+          return this->cell_weight(cell, status);
+        });
+}
 
 template <int dim>
 GLSSharpNavierStokesSolver<dim>::~GLSSharpNavierStokesSolver()
@@ -141,6 +155,34 @@ GLSSharpNavierStokesSolver<dim>::refine_ib()
 }
 
 
+template <int dim>
+unsigned int
+GLSSharpNavierStokesSolver<dim>::cell_weight(
+  const typename parallel::distributed::Triangulation<dim>::cell_iterator &cell,
+  const typename parallel::distributed::Triangulation<dim>::CellStatus
+  /*status*/) const
+{
+  // A cell is cut by a particle if some of its vertices are inside the
+  // particle and others are outside. The test only uses the geometry of the
+  // cell, so it also holds for the parent of cells that are coarsened.
+  unsigned int n_cuts = 0;
+  for (unsigned int p = 0; p < particles.size(); ++p)
+    {
+      unsigned int n_inside = 0;
+      for (unsigned int v = 0; v < GeometryInfo<dim>::vertices_per_cell; ++v)
+        {
+          if ((cell->vertex(v) - particles[p].position).norm() <=
+              particles[p].radius)
+            ++n_inside;
+        }
+      if (n_inside > 0 && n_inside < GeometryInfo<dim>::vertices_per_cell)
+        ++n_cuts;
+    }
+
+  return n_cuts *
+         this->simulation_parameters.particlesParameters.cut_cell_weight;
+}
+
 template <int dim>
 void
 GLSSharpNavierStokesSolver<dim>::force_on_ib()
@@ -51,6 +51,7 @@ NavierStokesBase<dim, VectorType, DofsType>::NavierStokesBase(
                     TimerOutput::summary,
                     TimerOutput::wall_times)
   , simulation_parameters(p_nsparam)
+  , memory_report_pending(false)
   , flow_control(simulation_parameters.flow_control)
   , velocity_fem_degree(p_nsparam.fem_parameters.velocity_order)
   , pressure_fem_degree(p_nsparam.fem_parameters.pressure_order)
@@ -115,8 +116,21 @@ NavierStokesBase<dim, VectorType, DofsType>::NavierStokesBase(
     }
   else
     {
-      if (simulation_parameters.simulation_control.output_control ==
-          Parameters::SimulationControl::OutputControl::time)
+      if (simulation_parameters.simulation_control.adapt &&
+          simulation_parameters.simulation_control.adaptation_criterion ==
+            Parameters::SimulationControl::TimeStepAdaptationCriterion::error)
+        {
+          AssertThrow(
+            simulation_parameters.simulation_control.output_control ==
+              Parameters::SimulationControl::OutputControl::iteration,
+            ExcMessage("The error controlled adaptative time stepping "
+                       "requires the output to be controlled by iteration."));
+          simulation_control =
+            std::make_shared<SimulationControlTransientErrorControlled>(
+              simulation_parameters.simulation_control);
+        }
+      else if (simulation_parameters.simulation_control.output_control ==
+               Parameters::SimulationControl::OutputControl::time)
         simulation_control =
           std::make_shared<SimulationControlTransientDynamicOutput>(
             simulation_parameters.simulation_control);
@@ -375,6 +389,15 @@ template <int dim, typename VectorType, typename DofsType>
 void
 NavierStokesBase<dim, VectorType, DofsType>::finish_simulation_fd()
 {
+  if (simulation_parameters.simulation_control.asynchronous_output)
+    {
+      TimerOutput::Scope t(this->computing_timer, "output");
+      asynchronous_vtu_writer.wait();
+    }
+
+  if (simulation_parameters.non_linear_solver.extrapolate_initial_guess)
+    this->print_non_linear_iterations_summary("Fluid dynamics");
+
   if (simulation_parameters.forces_parameters.calculate_force)
     this->write_output_forces();
 
@@ -419,6 +442,7 @@ template <int dim, typename VectorType, typename DofsType>
 void
 NavierStokesBase<dim, VectorType, DofsType>::percolate_time_vectors_fd()
 {
+  this->solution_m4 = this->solution_m3;
   this->solution_m3 = this->solution_m2;
   this->solution_m2 = this->solution_m1;
   this->solution_m1 = this->present_solution;
@@ -431,6 +455,14 @@ NavierStokesBase<dim, VectorType, DofsType>::finish_time_step_fd()
   if (simulation_parameters.simulation_control.method !=
       Parameters::SimulationControl::TimeSteppingMethod::steady)
     {
+      // Estimate the local truncation error of the time step before the
+      // previous solutions are overwritten
+      const unsigned int n_points =
+        simulation_control->get_error_estimate_n_points();
+      if (n_points > 0)
+        simulation_control->provide_error_estimate(
+          relative_velocity_extrapolation_difference(n_points));
+
       percolate_time_vectors_fd();
       const double CFL = calculate_CFL(this->dof_handler,
                                        this->present_solution,
@@ -450,6 +482,9 @@ NavierStokesBase<dim, VectorType, DofsType>::finish_time_step_fd()
       this->write_checkpoint();
     }
 
+  this->get_telemetry().write(simulation_control->get_step_number(),
+                              simulation_control->get_current_time());
+
   if (this->simulation_parameters.timer.type ==
       Parameters::Timer::Type::iteration)
     {
@@ -505,6 +540,7 @@ NavierStokesBase<dim, VectorType, DofsType>::iterate()
     }
   else
     {
+      extrapolate_initial_guess();
       PhysicsSolver<VectorType>::solve_non_linear_system(
         simulation_parameters.simulation_control.method, false, false);
       multiphysics->solve(simulation_parameters.simulation_control.method,
@@ -512,6 +548,76 @@ NavierStokesBase<dim, VectorType, DofsType>::iterate()
     }
 }
 
+template <int dim, typename VectorType, typename DofsType>
+double
+NavierStokesBase<dim, VectorType, DofsType>::
+  relative_velocity_extrapolation_difference(const unsigned int n_points)
+{
+  extrapolate_solution(
+    extrapolation_coefficients(n_points,
+                               simulation_control->get_time_steps_vector()),
+    {&this->solution_m1,
+     &this->solution_m2,
+     &this->solution_m3,
+     &this->solution_m4},
+    this->local_evaluation_point,
+    this->newton_update);
+
+  // Gather the locally owned velocity degrees of freedom
+  const IndexSet &owned_dofs = this->dof_handler.locally_owned_dofs();
+  IndexSet        velocity_dofs(this->dof_handler.n_dofs());
+  std::vector<types::global_dof_index> local_dof_indices(
+    this->fe->dofs_per_cell);
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          cell->get_dof_indices(local_dof_indices);
+          for (unsigned int i = 0; i < local_dof_indices.size(); ++i)
+            if (this->fe->system_to_component_index(i).first < dim &&
+                owned_dofs.is_element(local_dof_indices[i]))
+              velocity_dofs.add_index(local_dof_indices[i]);
+        }
+    }
+  velocity_dofs.compress();
+
+  double norm_square       = 0;
+  double difference_square = 0;
+  for (const auto index : velocity_dofs)
+    {
+      const double velocity   = this->present_solution(index);
+      const double difference = velocity - this->local_evaluation_point(index);
+      norm_square += velocity * velocity;
+      difference_square += difference * difference;
+    }
+  norm_square       = Utilities::MPI::sum(norm_square, mpi_communicator);
+  difference_square = Utilities::MPI::sum(difference_square, mpi_communicator);
+
+  return norm_square > 0 ? std::sqrt(difference_square / norm_square) :
+                           std::sqrt(difference_square);
+}
+
+template <int dim, typename VectorType, typename DofsType>
+void
+NavierStokesBase<dim, VectorType, DofsType>::extrapolate_initial_guess()
+{
+  const unsigned int n_points =
+    simulation_control->get_extrapolation_n_points();
+  if (!simulation_parameters.non_linear_solver.extrapolate_initial_guess ||
+      n_points == 0)
+    return;
+
+  extrapolate_solution(
+    extrapolation_coefficients(n_points,
+                               simulation_control->get_time_steps_vector()),
+    {&this->solution_m1, &this->solution_m2, &this->solution_m3},
+    this->local_evaluation_point,
+    this->newton_update);
+  this->nonzero_constraints.distribute(this->local_evaluation_point);
+  this->present_solution = this->local_evaluation_point;
+  this->set_extrapolated_initial_guess();
+}
+
 // Do an iteration with the NavierStokes Solver
 // Handles the fact that we may or may not be at a first
 // iteration with the solver and sets the initial condition
@@ -591,6 +697,47 @@ NavierStokesBase<dim, VectorType, DofsType>::first_iteration()
     }
 }
 
+template <int dim, typename VectorType, typename DofsType>
+void
+NavierStokesBase<dim, VectorType, DofsType>::print_memory_usage()
+{
+  MemoryReport report;
+  report.add_entry("Triangulation", this->triangulation->memory_consumption());
+  report.add_entry("DoFHandler", this->dof_handler.memory_consumption());
+  add_linear_system_memory_usage(report);
+  report.add_entry("Solution",
+                   this->present_solution.memory_consumption() +
+                     this->evaluation_point.memory_consumption() +
+                     this->local_evaluation_point.memory_consumption() +
+                     this->newton_update.memory_consumption() +
+                     this->system_rhs.memory_consumption());
+  report.add_entry("Previous solutions",
+                   this->solution_m1.memory_consumption() +
+                     this->solution_m2.memory_consumption() +
+                     this->solution_m3.memory_consumption() +
+                     this->solution_m4.memory_consumption());
+  if (this->simulation_parameters.post_processing.calculate_average_velocities)
+    report.add_entry("Average velocities",
+                     average_velocities->memory_consumption() +
+                       average_solution.memory_consumption());
+
+  report.print(this->pcout,
+               mpi_communicator,
+               "at step " +
+                 std::to_string(simulation_control->get_step_number()));
+}
+
+template <int dim, typename VectorType, typename DofsType>
+void
+NavierStokesBase<dim, VectorType, DofsType>::print_pending_memory_usage()
+{
+  if (!memory_report_pending)
+    return;
+
+  print_memory_usage();
+  memory_report_pending = false;
+}
+
 template <int dim, typename VectorType, typename DofsType>
 void
 NavierStokesBase<dim, VectorType, DofsType>::refine_mesh()
@@ -624,32 +771,29 @@ NavierStokesBase<dim, VectorType, DofsType>::refine_mesh_kelly()
   TimerOutput::Scope t(this->computing_timer, "refine");
 
   Vector<float> estimated_error_per_cell(tria.n_active_cells());
-  const FEValuesExtractors::Vector velocity(0);
-  const FEValuesExtractors::Scalar pressure(dim);
-  auto &                           present_solution = this->present_solution;
-  if (this->simulation_parameters.mesh_adaptation.variable ==
-      Parameters::MeshAdaptation::Variable::pressure)
-    {
-      KellyErrorEstimator<dim>::estimate(
-        *this->mapping,
-        this->dof_handler,
-        *this->face_quadrature,
-        typename std::map<types::boundary_id, const Function<dim, double> *>(),
-        present_solution,
-        estimated_error_per_cell,
-        this->fe->component_mask(pressure));
-    }
-  else if (this->simulation_parameters.mesh_adaptation.variable ==
-           Parameters::MeshAdaptation::Variable::velocity)
+  auto &        present_solution = this->present_solution;
+
+  const auto &variables = this->simulation_parameters.mesh_adaptation.variables;
+  const auto &weights =
+    this->simulation_parameters.mesh_adaptation.variable_weights;
+  if (variables.size() == 1)
+    estimate_refinement_indicator(variables[0], estimated_error_per_cell);
+  else
     {
-      KellyErrorEstimator<dim>::estimate(
-        *this->mapping,
-        this->dof_handler,
-        *this->face_quadrature,
-        typename std::map<types::boundary_id, const Function<dim, double> *>(),
-        present_solution,
-        estimated_error_per_cell,
-        this->fe->component_mask(velocity));
+      // Each indicator is normalized by its maximal value so that variables
+      // of different magnitudes can be combined
+      Vector<float> variable_indicator(tria.n_active_cells());
+      for (unsigned int v = 0; v < variables.size(); ++v)
+        {
+          estimate_refinement_indicator(variables[v], variable_indicator);
+          const double max_indicator =
+            Utilities::MPI::max(static_cast<double>(
+                                  variable_indicator.linfty_norm()),
+                                this->mpi_communicator);
+          if (max_indicator > 0)
+            estimated_error_per_cell.add(weights[v] / max_indicator,
+                                         variable_indicator);
+        }
     }
 
   if (this->simulation_parameters.mesh_adaptation.fractionType ==
@@ -688,24 +832,30 @@ NavierStokesBase<dim, VectorType, DofsType>::refine_mesh_kelly()
 
   tria.prepare_coarsening_and_refinement();
 
-  // Solution transfer objects for all the solutions
+  // A single solution transfer object packs all the solutions attached to
+  // the fluid dynamics dof handler
   parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer(
     this->dof_handler);
-  parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer_m1(
-    this->dof_handler);
-  parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer_m2(
-    this->dof_handler);
-  parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer_m3(
-    this->dof_handler);
-  solution_transfer.prepare_for_coarsening_and_refinement(present_solution);
-  solution_transfer_m1.prepare_for_coarsening_and_refinement(this->solution_m1);
-  solution_transfer_m2.prepare_for_coarsening_and_refinement(this->solution_m2);
-  solution_transfer_m3.prepare_for_coarsening_and_refinement(this->solution_m3);
 
-  multiphysics->prepare_for_mesh_adaptation();
+  std::vector<const VectorType *> sol_set_transfer;
+  sol_set_transfer.push_back(&present_solution);
+  sol_set_transfer.push_back(&this->solution_m1);
+  sol_set_transfer.push_back(&this->solution_m2);
+  sol_set_transfer.push_back(&this->solution_m3);
+  sol_set_transfer.push_back(&this->solution_m4);
+
   if (this->simulation_parameters.post_processing.calculate_average_velocities)
-    average_velocities->prepare_for_mesh_adaptation();
+    {
+      std::vector<const VectorType *> av_set_transfer =
+        average_velocities->prepare_for_mesh_adaptation();
+      sol_set_transfer.insert(sol_set_transfer.end(),
+                              av_set_transfer.begin(),
+                              av_set_transfer.end());
+    }
+
+  solution_transfer.prepare_for_coarsening_and_refinement(sol_set_transfer);
 
+  multiphysics->prepare_for_mesh_adaptation();
 
   tria.execute_coarsening_and_refinement();
   this->setup_dofs();
@@ -715,12 +865,19 @@ NavierStokesBase<dim, VectorType, DofsType>::refine_mesh_kelly()
   VectorType tmp_m1(locally_owned_dofs, this->mpi_communicator);
   VectorType tmp_m2(locally_owned_dofs, this->mpi_communicator);
   VectorType tmp_m3(locally_owned_dofs, this->mpi_communicator);
+  VectorType tmp_m4(locally_owned_dofs, this->mpi_communicator);
+
+  std::vector<VectorType *> x_system = {
+    &tmp, &tmp_m1, &tmp_m2, &tmp_m3, &tmp_m4};
+  if (this->simulation_parameters.post_processing.calculate_average_velocities)
+    {
+      std::vector<VectorType *> sum_vectors =
+        average_velocities->post_mesh_adaptation();
+      x_system.insert(x_system.end(), sum_vectors.begin(), sum_vectors.end());
+    }
 
   // Interpolate the solution at time and previous time
-  solution_transfer.interpolate(tmp);
-  solution_transfer_m1.interpolate(tmp_m1);
-  solution_transfer_m2.interpolate(tmp_m2);
-  solution_transfer_m3.interpolate(tmp_m3);
+  solution_transfer.interpolate(x_system);
 
   // Distribute constraints
   auto &nonzero_constraints = this->nonzero_constraints;
@@ -728,16 +885,108 @@ NavierStokesBase<dim, VectorType, DofsType>::refine_mesh_kelly()
   nonzero_constraints.distribute(tmp_m1);
   nonzero_constraints.distribute(tmp_m2);
   nonzero_constraints.distribute(tmp_m3);
+  nonzero_constraints.distribute(tmp_m4);
 
   // Fix on the new mesh
   present_solution  = tmp;
   this->solution_m1 = tmp_m1;
   this->solution_m2 = tmp_m2;
   this->solution_m3 = tmp_m3;
+  this->solution_m4 = tmp_m4;
 
   multiphysics->post_mesh_adaptation();
-  if (this->simulation_parameters.post_processing.calculate_average_velocities)
-    average_velocities->post_mesh_adaptation();
+}
+
+template <int dim, typename VectorType, typename DofsType>
+void
+NavierStokesBase<dim, VectorType, DofsType>::estimate_refinement_indicator(
+  const Parameters::MeshAdaptation::Variable variable,
+  Vector<float> &                            indicator)
+{
+  using Variable = Parameters::MeshAdaptation::Variable;
+
+  const FEValuesExtractors::Vector velocity(0);
+  const FEValuesExtractors::Scalar pressure(dim);
+
+  if (variable == Variable::velocity || variable == Variable::pressure)
+    {
+      KellyErrorEstimator<dim>::estimate(
+        *this->mapping,
+        this->dof_handler,
+        *this->face_quadrature,
+        typename std::map<types::boundary_id, const Function<dim, double> *>(),
+        this->present_solution,
+        indicator,
+        variable == Variable::pressure ? this->fe->component_mask(pressure) :
+                                         this->fe->component_mask(velocity));
+    }
+  else if (variable == Variable::temperature || variable == Variable::tracer)
+    {
+      const bool      temperature = (variable == Variable::temperature);
+      const PhysicsID physics_id =
+        temperature ? PhysicsID::heat_transfer : PhysicsID::tracer;
+      AssertThrow(
+        temperature ? this->simulation_parameters.multiphysics.heat_transfer :
+                      this->simulation_parameters.multiphysics.tracer,
+        ExcMessage(
+          std::string("Mesh adaptation on the ") +
+          (temperature ? "temperature requires the heat transfer physics" :
+                         "tracer requires the tracer physics")));
+
+      KellyErrorEstimator<dim>::estimate(
+        *this->mapping,
+        *multiphysics->get_dof_handler(physics_id),
+        multiphysics->get_face_quadrature(physics_id),
+        typename std::map<types::boundary_id, const Function<dim, double> *>(),
+        *multiphysics->get_solution(physics_id),
+        indicator);
+    }
+  else
+    {
+      FEValues<dim> fe_values(*this->mapping,
+                              *this->fe,
+                              *this->cell_quadrature,
+                              update_gradients | update_JxW_values);
+
+      const unsigned int          n_q_points = this->cell_quadrature->size();
+      std::vector<Tensor<2, dim>> velocity_gradients(n_q_points);
+
+      indicator = 0;
+      for (const auto &cell : this->dof_handler.active_cell_iterators())
+        {
+          if (cell->is_locally_owned())
+            {
+              fe_values.reinit(cell);
+              fe_values[velocity].get_function_gradients(
+                this->present_solution, velocity_gradients);
+
+              double integral = 0;
+              for (unsigned int q = 0; q < n_q_points; ++q)
+                {
+                  const Tensor<2, dim> strain_rate =
+                    0.5 * (velocity_gradients[q] +
+                           transpose(velocity_gradients[q]));
+                  const Tensor<2, dim> rotation_rate =
+                    0.5 * (velocity_gradients[q] -
+                           transpose(velocity_gradients[q]));
+
+                  // The magnitude of the vorticity is related to the norm
+                  // of the rotation rate tensor by |w|^2 = 2 |W|^2
+                  double value;
+                  if (variable == Variable::vorticity)
+                    value = 2. * rotation_rate.norm_square();
+                  else
+                    value = std::max(0.5 * (rotation_rate.norm_square() -
+                                            strain_rate.norm_square()),
+                                     0.);
+
+                  integral += value * fe_values.JxW(q);
+                }
+              indicator(cell->active_cell_index()) =
+                cell->diameter() * std::sqrt(integral);
+            }
+        }
+    }
 }
 
 template <int dim, typename VectorType, typename DofsType>
@@ -746,20 +995,28 @@ NavierStokesBase<dim, VectorType, DofsType>::refine_mesh_uniform()
 {
   TimerOutput::Scope t(this->computing_timer, "refine");
 
-  // Solution transfer objects for all the solutions
+  // A single solution transfer object packs all the solutions attached to
+  // the fluid dynamics dof handler
   parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer(
     this->dof_handler);
-  parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer_m1(
-    this->dof_handler);
-  parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer_m2(
-    this->dof_handler);
-  parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer_m3(
-    this->dof_handler);
-  solution_transfer.prepare_for_coarsening_and_refinement(
-    this->present_solution);
-  solution_transfer_m1.prepare_for_coarsening_and_refinement(this->solution_m1);
-  solution_transfer_m2.prepare_for_coarsening_and_refinement(this->solution_m2);
-  solution_transfer_m3.prepare_for_coarsening_and_refinement(this->solution_m3);
+
+  std::vector<const VectorType *> sol_set_transfer;
+  sol_set_transfer.push_back(&this->present_solution);
+  sol_set_transfer.push_back(&this->solution_m1);
+  sol_set_transfer.push_back(&this->solution_m2);
+  sol_set_transfer.push_back(&this->solution_m3);
+  sol_set_transfer.push_back(&this->solution_m4);
+
+  if (this->simulation_parameters.post_processing.calculate_average_velocities)
+    {
+      std::vector<const VectorType *> av_set_transfer =
+        average_velocities->prepare_for_mesh_adaptation();
+      sol_set_transfer.insert(sol_set_transfer.end(),
+                              av_set_transfer.begin(),
+                              av_set_transfer.end());
+    }
+
+  solution_transfer.prepare_for_coarsening_and_refinement(sol_set_transfer);
 
   multiphysics->prepare_for_mesh_adaptation();
 
@@ -773,12 +1030,19 @@ NavierStokesBase<dim, VectorType, DofsType>::refine_mesh_uniform()
   VectorType tmp_m1(locally_owned_dofs, this->mpi_communicator);
   VectorType tmp_m2(locally_owned_dofs, this->mpi_communicator);
   VectorType tmp_m3(locally_owned_dofs, this->mpi_communicator);
+  VectorType tmp_m4(locally_owned_dofs, this->mpi_communicator);
+
+  std::vector<VectorType *> x_system = {
+    &tmp, &tmp_m1, &tmp_m2, &tmp_m3, &tmp_m4};
+  if (this->simulation_parameters.post_processing.calculate_average_velocities)
+    {
+      std::vector<VectorType *> sum_vectors =
+        average_velocities->post_mesh_adaptation();
+      x_system.insert(x_system.end(), sum_vectors.begin(), sum_vectors.end());
+    }
 
   // Interpolate the solution at time and previous time
-  solution_transfer.interpolate(tmp);
-  solution_transfer_m1.interpolate(tmp_m1);
-  solution_transfer_m2.interpolate(tmp_m2);
-  solution_transfer_m3.interpolate(tmp_m3);
+  solution_transfer.interpolate(x_system);
 
   // Distribute constraints
   auto &nonzero_constraints = this->nonzero_constraints;
@@ -786,12 +1050,14 @@ NavierStokesBase<dim, VectorType, DofsType>::refine_mesh_uniform()
   nonzero_constraints.distribute(tmp_m1);
   nonzero_constraints.distribute(tmp_m2);
   nonzero_constraints.distribute(tmp_m3);
+  nonzero_constraints.distribute(tmp_m4);
 
   // Fix on the new mesh
   present_solution  = tmp;
   this->solution_m1 = tmp_m1;
   this->solution_m2 = tmp_m2;
   this->solution_m3 = tmp_m3;
+  this->solution_m4 = tmp_m4;
 
   multiphysics->post_mesh_adaptation();
 }
@@ -1009,6 +1275,7 @@ NavierStokesBase<dim, VectorType, DofsType>::read_checkpoint()
   std::string prefix = this->simulation_parameters.restart_parameters.filename;
   this->simulation_control->read(prefix);
   this->pvdhandler.read(prefix);
+  read_xdmf_entries(this->xdmf_entries, prefix);
 
   const std::string filename = prefix + ".triangulation";
   std::ifstream     in(filename.c_str());
@@ -1119,7 +1386,10 @@ NavierStokesBase<dim, VectorType, DofsType>::write_output_results(
     DataComponentInterpretation::component_is_scalar);
 
 
-  DataOut<dim> data_out;
+  // The detached data out can be written on a background thread once its
+  // patches are built
+  auto          detached_data_out = std::make_shared<DetachedDataOut<dim>>();
+  DataOut<dim> &data_out          = *detached_data_out;
 
   // Additional flag to enable the output of high-order elements
   DataOutBase::VtkFlags flags;
@@ -1231,14 +1501,36 @@ NavierStokesBase<dim, VectorType, DofsType>::write_output_results(
                          subdivision,
                          DataOut<dim>::curved_inner_cells);
 
-  write_vtu_and_pvd<dim>(this->pvdhandler,
-                         data_out,
-                         folder,
-                         solution_name,
-                         time,
-                         iter,
-                         group_files,
-                         this->mpi_communicator);
+  // The hdf5 file is written collectively and thus cannot be written on a
+  // background thread
+  if (simulation_parameters.simulation_control.output_format ==
+      Parameters::SimulationControl::OutputFormat::hdf5)
+    write_hdf5_and_xdmf<dim>(
+      xdmf_entries,
+      data_out,
+      folder,
+      solution_name,
+      time,
+      iter,
+      simulation_parameters.simulation_control.hdf5_compression,
+      this->mpi_communicator);
+  else if (simulation_parameters.simulation_control.asynchronous_output)
+    asynchronous_vtu_writer.write_vtu_and_pvd(this->pvdhandler,
+                                              detached_data_out,
+                                              folder,
+                                              solution_name,
+                                              time,
+                                              iter,
+                                              this->mpi_communicator);
+  else
+    write_vtu_and_pvd<dim>(this->pvdhandler,
+                           data_out,
+                           folder,
+                           solution_name,
+                           time,
+                           iter,
+                           group_files,
+                           this->mpi_communicator);
 
   if (simulation_control->get_output_boundaries())
     {
@@ -1294,16 +1586,25 @@ void
 NavierStokesBase<dim, VectorType, DofsType>::write_checkpoint()
 {
   TimerOutput::Scope timer(this->computing_timer, "write_checkpoint");
+
+  // The pvd handler saved with the checkpoint already lists the output in
+  // progress, which must be written before the checkpoint refers to it
+  if (simulation_parameters.simulation_control.asynchronous_output)
+    asynchronous_vtu_writer.wait();
+
   std::string prefix = this->simulation_parameters.restart_parameters.filename;
   if (Utilities::MPI::this_mpi_process(this->mpi_communicator) == 0)
     {
       simulation_control->save(prefix);
       this->pvdhandler.save(prefix);
+      save_xdmf_entries(this->xdmf_entries, prefix);
 
       if (simulation_parameters.flow_control.enable_flow_control)
         this->flow_control.save(prefix);
     }
 
+  // The fourth previous solution is only used by the error estimate of the
+  // BDF3 scheme and is not written, so that the checkpoints are unchanged
   std::vector<const VectorType *> sol_set_transfer;
   sol_set_transfer.push_back(&this->present_solution);
   sol_set_transfer.push_back(&this->solution_m1);
@@ -4,11 +4,8 @@
 
 template <int dim, typename VectorType, typename DofsType>
 AverageVelocities<dim, VectorType, DofsType>::AverageVelocities(
-  DoFHandler<dim> &dof_handler)
-  : solution_transfer_sum_velocity_dt(dof_handler)
-  , solution_transfer_sum_reynolds_normal_stress_dt(dof_handler)
-  , solution_transfer_sum_reynolds_shear_stress_dt(dof_handler)
-  , average_calculation(false)
+  DoFHandler<dim> & /*dof_handler*/)
+  : average_calculation(false)
 {}
 
 template <int dim, typename VectorType, typename DofsType>
@@ -180,34 +177,31 @@ AverageVelocities<dim, VectorType, DofsType>::initialize_vectors(
 }
 
 template <int dim, typename VectorType, typename DofsType>
-void
+std::vector<const VectorType *>
 AverageVelocities<dim, VectorType, DofsType>::prepare_for_mesh_adaptation()
 {
   get_av  = sum_velocity_dt;
   get_rns = sum_reynolds_normal_stress_dt;
   get_rss = sum_reynolds_shear_stress_dt;
 
-  solution_transfer_sum_velocity_dt.prepare_for_coarsening_and_refinement(
-    get_av);
-  solution_transfer_sum_reynolds_normal_stress_dt
-    .prepare_for_coarsening_and_refinement(get_rns);
-  solution_transfer_sum_reynolds_shear_stress_dt
-    .prepare_for_coarsening_and_refinement(get_rss);
+  std::vector<const VectorType *> av_set_transfer;
+  av_set_transfer.push_back(&get_av);
+  av_set_transfer.push_back(&get_rns);
+  av_set_transfer.push_back(&get_rss);
+
+  return av_set_transfer;
 }
 
 template <int dim, typename VectorType, typename DofsType>
-void
+std::vector<VectorType *>
 AverageVelocities<dim, VectorType, DofsType>::post_mesh_adaptation()
 {
-  solution_transfer_sum_velocity_dt.interpolate(sum_velocity_dt);
-  solution_transfer_sum_reynolds_normal_stress_dt.interpolate(
-    sum_reynolds_normal_stress_dt);
-  solution_transfer_sum_reynolds_shear_stress_dt.interpolate(
-    sum_reynolds_shear_stress_dt);
+  std::vector<VectorType *> sum_vectors;
+  sum_vectors.push_back(&sum_velocity_dt);
+  sum_vectors.push_back(&sum_reynolds_normal_stress_dt);
+  sum_vectors.push_back(&sum_reynolds_shear_stress_dt);
 
-  sum_velocity_dt_with_ghost_cells = sum_velocity_dt;
-  sum_rns_dt_with_ghost_cells      = sum_reynolds_normal_stress_dt;
-  sum_rss_dt_with_ghost_cells      = sum_reynolds_shear_stress_dt;
+  return sum_vectors;
 }
 
 template <int dim, typename VectorType, typename DofsType>
@@ -275,6 +269,30 @@ AverageVelocities<dim, VectorType, DofsType>::read(std::string prefix)
   return sum_vectors;
 }
 
+template <int dim, typename VectorType, typename DofsType>
+std::size_t
+AverageVelocities<dim, VectorType, DofsType>::memory_consumption() const
+{
+  std::size_t memory = 0;
+  for (const VectorType *vector : {&velocity_dt,
+                                   &sum_velocity_dt,
+                                   &average_velocities,
+                                   &get_av,
+                                   &reynolds_normal_stress_dt,
+                                   &sum_reynolds_normal_stress_dt,
+                                   &reynolds_normal_stresses,
+                                   &get_rns,
+                                   &reynolds_shear_stress_dt,
+                                   &sum_reynolds_shear_stress_dt,
+                                   &reynolds_shear_stresses,
+                                   &get_rss,
+                                   &sum_velocity_dt_with_ghost_cells,
+                                   &sum_rns_dt_with_ghost_cells,
+                                   &sum_rss_dt_with_ghost_cells})
+    memory += vector->memory_consumption();
+  return memory;
+}
+
 
 template class AverageVelocities<2, TrilinosWrappers::MPI::Vector, IndexSet>;
 
@@ -1,3 +1,5 @@
+#include <deal.II/base/timer.h>
+
 #include <deal.II/dofs/dof_renumbering.h>
 #include <deal.II/dofs/dof_tools.h>
 
@@ -465,6 +467,9 @@ Tracer<dim>::finish_simulation()
   unsigned int this_mpi_process(
     Utilities::MPI::this_mpi_process(mpi_communicator));
 
+  if (simulation_parameters.non_linear_solver.extrapolate_initial_guess)
+    this->print_non_linear_iterations_summary("Tracer");
+
   if (this_mpi_process == 0 &&
       simulation_parameters.analytical_solution->verbosity ==
         Parameters::Verbosity::verbose)
@@ -487,16 +492,55 @@ template <int dim>
 void
 Tracer<dim>::percolate_time_vectors()
 {
+  solution_m4 = solution_m3;
   solution_m3 = solution_m2;
   solution_m2 = solution_m1;
   solution_m1 = present_solution;
 }
 
+template <int dim>
+void
+Tracer<dim>::extrapolate_initial_guess()
+{
+  const unsigned int n_points =
+    simulation_control->get_extrapolation_n_points();
+  if (!simulation_parameters.non_linear_solver.extrapolate_initial_guess ||
+      n_points == 0)
+    return;
+
+  extrapolate_solution(
+    extrapolation_coefficients(n_points,
+                               simulation_control->get_time_steps_vector()),
+    {&solution_m1, &solution_m2, &solution_m3},
+    local_evaluation_point,
+    newton_update);
+  nonzero_constraints.distribute(local_evaluation_point);
+  present_solution = local_evaluation_point;
+  this->set_extrapolated_initial_guess();
+}
+
 template <int dim>
 void
 Tracer<dim>::finish_time_step()
 {
+  // Estimate the local truncation error of the time step before the previous
+  // solutions are overwritten
+  const unsigned int n_points =
+    simulation_control->get_error_estimate_n_points();
+  if (n_points > 0)
+    simulation_control->provide_error_estimate(
+      relative_extrapolation_difference(
+        extrapolation_coefficients(n_points,
+                                   simulation_control->get_time_steps_vector()),
+        present_solution,
+        {&solution_m1, &solution_m2, &solution_m3, &solution_m4},
+        local_evaluation_point,
+        newton_update));
+
   percolate_time_vectors();
+
+  this->get_telemetry().write(simulation_control->get_step_number(),
+                              simulation_control->get_current_time());
 }
 
 template <int dim>
@@ -634,10 +678,13 @@ template <int dim>
 void
 Tracer<dim>::pre_mesh_adaptation()
 {
-  solution_transfer.prepare_for_coarsening_and_refinement(present_solution);
-  solution_transfer_m1.prepare_for_coarsening_and_refinement(solution_m1);
-  solution_transfer_m2.prepare_for_coarsening_and_refinement(solution_m2);
-  solution_transfer_m3.prepare_for_coarsening_and_refinement(solution_m3);
+  std::vector<const TrilinosWrappers::MPI::Vector *> sol_set_transfer;
+  sol_set_transfer.push_back(&present_solution);
+  sol_set_transfer.push_back(&solution_m1);
+  sol_set_transfer.push_back(&solution_m2);
+  sol_set_transfer.push_back(&solution_m3);
+  sol_set_transfer.push_back(&solution_m4);
+  solution_transfer.prepare_for_coarsening_and_refinement(sol_set_transfer);
 }
 
 template <int dim>
@@ -652,24 +699,26 @@ Tracer<dim>::post_mesh_adaptation()
   TrilinosWrappers::MPI::Vector tmp_m1(locally_owned_dofs, mpi_communicator);
   TrilinosWrappers::MPI::Vector tmp_m2(locally_owned_dofs, mpi_communicator);
   TrilinosWrappers::MPI::Vector tmp_m3(locally_owned_dofs, mpi_communicator);
+  TrilinosWrappers::MPI::Vector tmp_m4(locally_owned_dofs, mpi_communicator);
 
   // Interpolate the solution at time and previous time
-  solution_transfer.interpolate(tmp);
-  solution_transfer_m1.interpolate(tmp_m1);
-  solution_transfer_m2.interpolate(tmp_m2);
-  solution_transfer_m3.interpolate(tmp_m3);
+  std::vector<TrilinosWrappers::MPI::Vector *> x_system = {
+    &tmp, &tmp_m1, &tmp_m2, &tmp_m3, &tmp_m4};
+  solution_transfer.interpolate(x_system);
 
   // Distribute constraints
   nonzero_constraints.distribute(tmp);
   nonzero_constraints.distribute(tmp_m1);
   nonzero_constraints.distribute(tmp_m2);
   nonzero_constraints.distribute(tmp_m3);
+  nonzero_constraints.distribute(tmp_m4);
 
   // Fix on the new mesh
   present_solution = tmp;
   solution_m1      = tmp_m1;
   solution_m2      = tmp_m2;
   solution_m3      = tmp_m3;
+  solution_m4      = tmp_m4;
 }
 
 template <int dim>
@@ -743,6 +792,9 @@ Tracer<dim>::setup_dofs()
   solution_m3.reinit(locally_owned_dofs,
                      locally_relevant_dofs,
                      mpi_communicator);
+  solution_m4.reinit(locally_owned_dofs,
+                     locally_relevant_dofs,
+                     mpi_communicator);
 
   system_rhs.reinit(locally_owned_dofs, mpi_communicator);
 
@@ -815,6 +867,9 @@ Tracer<dim>::setup_dofs()
 
   this->pcout << "   Number of tracer degrees of freedom: "
               << dof_handler.n_dofs() << std::endl;
+
+  multiphysics->set_dof_handler(PhysicsID::tracer, &this->dof_handler);
+  multiphysics->set_solution(PhysicsID::tracer, &this->present_solution);
 }
 
 template <int dim>
@@ -863,7 +918,9 @@ Tracer<dim>::solve_linear_system(const bool initial_step,
 
   TrilinosWrappers::PreconditionILU ilu_preconditioner;
 
+  Timer timer;
   ilu_preconditioner.initialize(system_matrix, preconditionerOptions);
+  this->get_telemetry().add_preconditioner_setup(timer.wall_time());
 
   TrilinosWrappers::MPI::Vector completely_distributed_solution(
     locally_owned_dofs, mpi_communicator);
@@ -886,6 +943,8 @@ Tracer<dim>::solve_linear_system(const bool initial_step,
                system_rhs,
                ilu_preconditioner);
 
+  this->get_telemetry().add_linear_solve(solver_control.last_step());
+
   if (simulation_parameters.linear_solver.verbosity !=
       Parameters::Verbosity::quiet)
     {
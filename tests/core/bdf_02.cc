@@ -0,0 +1,81 @@
+/**
+ * @brief This code tests the coefficients used to extrapolate the solution
+ * from the previous time steps with variable time steps and checks that a
+ * second order polynomial in time is extrapolated exactly.
+ */
+
+// Deal.II
+#include <deal.II/lac/vector.h>
+
+// Lethe
+#include <core/bdf.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+
+void
+test()
+{
+  std::vector<double> dt(4, 0.1);
+  dt[1] = 0.2;
+  dt[2] = 0.3;
+  dt[3] = 0.4;
+
+  Vector<double> linear_coefficients = extrapolation_coefficients(2, dt);
+  deallog << "2 points : " << linear_coefficients[0] << " "
+          << linear_coefficients[1] << std::endl;
+
+  Vector<double> quadratic_coefficients = extrapolation_coefficients(3, dt);
+  deallog << "3 points : " << quadratic_coefficients[0] << " "
+          << quadratic_coefficients[1] << " " << quadratic_coefficients[2]
+          << std::endl;
+
+  // Previous solutions of u(t) = 1 + 2t + 3t^2 at t=-0.1, t=-0.3 and t=-0.6
+  Vector<double> solution_m1(1), solution_m2(1), solution_m3(1);
+  solution_m1 = 0.83;
+  solution_m2 = 0.67;
+  solution_m3 = 0.88;
+
+  Vector<double> extrapolation(1), scratch(1);
+  extrapolate_solution(quadratic_coefficients,
+                       {&solution_m1, &solution_m2, &solution_m3},
+                       extrapolation,
+                       scratch);
+  deallog << "Extrapolation : " << extrapolation[0] << std::endl;
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+}
@@ -0,0 +1,105 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2021 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief This test checks the memory reported for an ILU preconditioner,
+ * which is the preconditioner entry of the memory report of the fluid
+ * dynamics solvers. Once the factorization is computed, the factors hold at
+ * least the diagonal and the off-diagonal entries of the matrix. The amounts
+ * depend on the Trilinos version, so only the bounds are written.
+ */
+
+// Deal.II
+#include <deal.II/lac/trilinos_precondition.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+
+// Lethe
+#include <core/memory_report.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+void
+test()
+{
+  // One dimensional Laplacian
+  const unsigned int             n_rows = 100;
+  TrilinosWrappers::SparseMatrix matrix(n_rows, n_rows, 3);
+  for (unsigned int i = 0; i < n_rows; ++i)
+    {
+      matrix.set(i, i, 2.);
+      if (i > 0)
+        matrix.set(i, i - 1, -1.);
+      if (i + 1 < n_rows)
+        matrix.set(i, i + 1, -1.);
+    }
+  matrix.compress(VectorOperation::insert);
+
+  TrilinosWrappers::PreconditionILU preconditioner;
+  preconditioner.initialize(matrix);
+
+  const std::size_t bytes = ilu_memory_consumption(preconditioner);
+
+  // Values of the diagonal and of the off-diagonal entries of the matrix
+  const std::size_t n_entries   = 3 * n_rows - 2;
+  const std::size_t lower_bound = n_entries * sizeof(double);
+
+  deallog << "Preconditioner memory is non-zero: "
+          << (bytes > 0 ? "true" : "false") << std::endl;
+  deallog << "Preconditioner memory holds the entries of the matrix: "
+          << (bytes >= lower_bound ? "true" : "false") << std::endl;
+  deallog << "Preconditioner memory is below the dense matrix: "
+          << (bytes < n_rows * n_rows * sizeof(double) ? "true" : "false")
+          << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      initlog();
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(
+        argc, argv, numbers::invalid_unsigned_int);
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
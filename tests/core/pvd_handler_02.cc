@@ -0,0 +1,109 @@
+/**
+ * @brief Check that the incremental writing of the pvd file and of the pvd
+ * checkpoint leads to the same result as writing them entirely
+ */
+
+// Lethe
+#include <core/pvd_handler.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+// Std
+#include <fstream>
+#include <sstream>
+
+std::string
+read_file(const std::string &filename)
+{
+  std::ifstream     input(filename.c_str());
+  std::stringstream buffer;
+  buffer << input.rdbuf();
+  return buffer.str();
+}
+
+void
+test()
+{
+  deallog << "Beggining" << std::endl;
+
+  PVDHandler pvdhandlerIncremental;
+  pvdhandlerIncremental.append(0.5, "output.0001.pvtu");
+  pvdhandlerIncremental.append(1.0, "output.0002.pvtu");
+  pvdhandlerIncremental.write_pvd("incremental.pvd");
+  pvdhandlerIncremental.save("restart");
+
+  pvdhandlerIncremental.append(1.5, "output.0003.pvtu");
+  pvdhandlerIncremental.write_pvd("incremental.pvd");
+  pvdhandlerIncremental.append(2.0, "output.0004.pvtu");
+  pvdhandlerIncremental.write_pvd("incremental.pvd");
+  pvdhandlerIncremental.save("restart");
+
+  PVDHandler pvdhandlerFull;
+  pvdhandlerFull.times_and_names = pvdhandlerIncremental.times_and_names;
+  pvdhandlerFull.write_pvd("full.pvd");
+
+  const std::string incremental_pvd = read_file("incremental.pvd");
+  if (incremental_pvd != read_file("full.pvd"))
+    throw std::runtime_error("Incremental pvd file is not equal");
+
+  std::istringstream pvd_lines(incremental_pvd);
+  std::string        line;
+  while (std::getline(pvd_lines, line))
+    deallog << line << std::endl;
+
+  PVDHandler pvdhandlerWorker;
+  pvdhandlerWorker.read("restart");
+
+  if (pvdhandlerWorker.times_and_names.size() !=
+      pvdhandlerIncremental.times_and_names.size())
+    throw std::runtime_error("Size are not equal");
+  unsigned int size = pvdhandlerWorker.times_and_names.size();
+  for (unsigned int i = 0; i < size; ++i)
+    {
+      deallog << pvdhandlerWorker.times_and_names[i].second << std::endl;
+      if (!approximatelyEqual(pvdhandlerIncremental.times_and_names[i].first,
+                              pvdhandlerWorker.times_and_names[i].first,
+                              1e-8))
+        throw std::runtime_error("Time not equal");
+      if (pvdhandlerIncremental.times_and_names[i].second !=
+          pvdhandlerWorker.times_and_names[i].second)
+        throw std::runtime_error("File not equal");
+    }
+  deallog << "OK" << std::endl;
+}
+
+int
+main()
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+}
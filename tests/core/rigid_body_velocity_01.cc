@@ -0,0 +1,124 @@
+/**
+ * @brief Check the velocity field of a rigid body in translation and rotation
+ * in 2D and 3D, and the motion of its center of rotation with time
+ */
+
+// Lethe
+#include <core/rigid_body_velocity.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+void
+test()
+{
+  deallog << "Beggining" << std::endl;
+
+  // 2D rigid body rotating around the origin
+  {
+    Tensor<1, 2> translational_velocity;
+    Tensor<1, 3> angular_velocity;
+    Point<2>     center_of_rotation(0, 0);
+    translational_velocity[1] = 1;
+    angular_velocity[2]       = 1;
+
+    RigidBodyVelocity<2> velocity(translational_velocity,
+                                  angular_velocity,
+                                  center_of_rotation);
+
+    std::vector<Point<2>>       points = {Point<2>(1, 1), Point<2>(0, 2)};
+    std::vector<Vector<double>> values(points.size(), Vector<double>(2));
+    velocity.vector_value_list(points, values);
+
+    for (unsigned int i = 0; i < points.size(); ++i)
+      {
+        deallog << "Velocity at " << points[i] << " : " << values[i][0] << " "
+                << values[i][1] << std::endl;
+        for (unsigned int d = 0; d < 2; ++d)
+          if (std::abs(velocity.value(points[i], d) - values[i][d]) > 1e-12)
+            throw std::runtime_error("Value and vector value differ");
+      }
+  }
+
+  // 3D rigid body rotating around an axis that does not cross the origin
+  {
+    Tensor<1, 3> translational_velocity;
+    Tensor<1, 3> angular_velocity;
+    Point<3>     center_of_rotation(1, 1, 0);
+    translational_velocity[0] = 1;
+    angular_velocity[2]       = 2;
+
+    RigidBodyVelocity<3> velocity(translational_velocity,
+                                  angular_velocity,
+                                  center_of_rotation);
+
+    std::vector<Point<3>>       points = {Point<3>(2, 1, 0), Point<3>(1, 3, 1)};
+    std::vector<Vector<double>> values(points.size(), Vector<double>(3));
+    velocity.vector_value_list(points, values);
+
+    for (unsigned int i = 0; i < points.size(); ++i)
+      {
+        deallog << "Velocity at " << points[i] << " : " << values[i][0] << " "
+                << values[i][1] << " " << values[i][2] << std::endl;
+        for (unsigned int d = 0; d < 3; ++d)
+          if (std::abs(velocity.value(points[i], d) - values[i][d]) > 1e-12)
+            throw std::runtime_error("Value and vector value differ");
+      }
+  }
+
+  // 2D rigid body whose center of rotation has moved with the translation
+  {
+    Tensor<1, 2> translational_velocity;
+    Tensor<1, 3> angular_velocity;
+    Point<2>     center_of_rotation(0, 0);
+    translational_velocity[1] = 1;
+    angular_velocity[2]       = 1;
+
+    RigidBodyVelocity<2> velocity(translational_velocity,
+                                  angular_velocity,
+                                  center_of_rotation);
+    velocity.set_time(1);
+
+    const Point<2> point(1, 1);
+    deallog << "Velocity at " << point << " at time 1 : "
+            << velocity.value(point, 0) << " " << velocity.value(point, 1)
+            << std::endl;
+  }
+
+  deallog << "OK" << std::endl;
+}
+
+int
+main()
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+}
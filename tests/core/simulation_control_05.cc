@@ -0,0 +1,137 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2021 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief This test checks that the error controlled simulation control adapts
+ * the time step of a BDF1 integration of dy/dt = -10 y from the estimate of
+ * its local truncation error and that the time step is bounded by the
+ * maximal growth of the time step
+ */
+
+// Deal.II
+#include <deal.II/lac/vector.h>
+
+// Lethe
+#include <core/bdf.h>
+#include <core/parameters.h>
+#include <core/simulation_control.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+void
+test()
+{
+  Parameters::SimulationControl simulation_control_parameters;
+
+  simulation_control_parameters.dt     = 0.001;
+  simulation_control_parameters.adapt  = true;
+  simulation_control_parameters.maxCFL = 1;
+  simulation_control_parameters.method =
+    Parameters::SimulationControl::TimeSteppingMethod::bdf1;
+  simulation_control_parameters.adaptative_time_step_scaling = 2;
+  simulation_control_parameters.adaptation_criterion =
+    Parameters::SimulationControl::TimeStepAdaptationCriterion::error;
+  simulation_control_parameters.error_tolerance = 1e-3;
+
+  simulation_control_parameters.timeEnd                = 0.1;
+  simulation_control_parameters.number_mesh_adaptation = 0;
+  simulation_control_parameters.output_name            = "test";
+  simulation_control_parameters.subdivision            = 1;
+  simulation_control_parameters.output_folder          = "canard";
+  simulation_control_parameters.output_frequency       = 1;
+
+  SimulationControlTransientErrorControlled simulation_control(
+    simulation_control_parameters);
+
+  const double   lambda = -10;
+  Vector<double> present_solution(1);
+  Vector<double> solution_m1(1);
+  Vector<double> solution_m2(1);
+  Vector<double> solution_m3(1);
+  Vector<double> predictor(1);
+  Vector<double> scratch(1);
+  solution_m1 = 1.;
+  solution_m2 = 1.;
+  solution_m3 = 1.;
+
+  deallog << "Iteration : " << simulation_control.get_step_number()
+          << "    Time : " << simulation_control.get_current_time()
+          << std::endl;
+
+  while (simulation_control.integrate())
+    {
+      // Backward Euler step of dy/dt = lambda y
+      present_solution[0] =
+        solution_m1[0] / (1. - lambda * simulation_control.get_time_step());
+
+      const unsigned int n_points =
+        simulation_control.get_error_estimate_n_points();
+      if (n_points > 0)
+        simulation_control.provide_error_estimate(
+          relative_extrapolation_difference(
+            extrapolation_coefficients(
+              n_points, simulation_control.get_time_steps_vector()),
+            present_solution,
+            {&solution_m1, &solution_m2, &solution_m3},
+            predictor,
+            scratch));
+
+      solution_m3 = solution_m2;
+      solution_m2 = solution_m1;
+      solution_m1 = present_solution;
+
+      deallog << "Iteration : " << simulation_control.get_step_number()
+              << "    Time : " << simulation_control.get_current_time()
+              << "    Time step : " << simulation_control.get_time_step()
+              << std::endl;
+    }
+}
+
+int
+main()
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+}
@@ -0,0 +1,107 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2021 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief This test checks the adaptative time stepping of the DEM. The time
+ * step is constant until the CFL is set, grows by the adaptative time step
+ * scaling while it is below the critical time step, which is first the
+ * Rayleigh bound and then the collision bound of a contact, and never
+ * exceeds the critical time step even though the maximal CFL is large.
+ */
+
+// Lethe
+#include <core/parameters.h>
+#include <core/simulation_control.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+void
+test()
+{
+  Parameters::SimulationControl simulation_control_parameters;
+
+  simulation_control_parameters.dt     = 0.001;
+  simulation_control_parameters.adapt  = true;
+  simulation_control_parameters.maxCFL = 99;
+  simulation_control_parameters.method =
+    Parameters::SimulationControl::TimeSteppingMethod::bdf1;
+  simulation_control_parameters.adaptative_time_step_scaling = 1.1;
+
+  simulation_control_parameters.timeEnd                = 0.015;
+  simulation_control_parameters.number_mesh_adaptation = 0;
+  simulation_control_parameters.output_name            = "test";
+  simulation_control_parameters.subdivision            = 1;
+  simulation_control_parameters.output_folder          = "canard";
+  simulation_control_parameters.output_frequency       = 1;
+
+  SimulationControlTransientDEM simulation_control(
+    simulation_control_parameters);
+
+  // Critical time steps given by the Rayleigh bound, then by the collision
+  // bound of a contact which starts at the tenth iteration
+  const double rayleigh_bound  = 0.0015;
+  const double collision_bound = 0.0008;
+
+  while (simulation_control.integrate())
+    {
+      const unsigned int step = simulation_control.get_step_number();
+      deallog << "Iteration : " << step
+              << "    Time step : " << simulation_control.get_time_step()
+              << std::endl;
+
+      // The particles are inserted at the third iteration
+      if (step >= 3)
+        simulation_control.set_CFL(simulation_control.get_time_step() /
+                                   (step < 10 ? rayleigh_bound :
+                                                collision_bound));
+    }
+}
+
+int
+main()
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+}
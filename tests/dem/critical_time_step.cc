@@ -0,0 +1,194 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2021 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+
+ *
+ * Author: Shahab Golshan, Polytechnique Montreal, 2019-
+ */
+
+/**
+ * @brief This test checks the critical time step of a particle, which is
+ * first given by a fraction of its Rayleigh time step and then by a fraction
+ * of the Hertzian collision time of a fast particle-wall contact, with and
+ * without sub-steps of the particle-wall contact forces.
+ */
+
+// Deal.II includes
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/particle.h>
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/particle_iterator.h>
+
+// Lethe
+#include <dem/dem_properties.h>
+#include <dem/dem_solver_parameters.h>
+#include <dem/find_critical_time_step.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+using namespace dealii;
+
+template <int dim>
+void
+test()
+{
+  // Creating the mesh and refinement
+  parallel::distributed::Triangulation<dim> tr(MPI_COMM_WORLD);
+  int                                       hyper_cube_length = 1;
+  GridGenerator::hyper_cube(tr,
+                            -1 * hyper_cube_length,
+                            hyper_cube_length,
+                            true);
+  MappingQ<dim> mapping(1);
+
+  // Defining particle handler
+  Particles::ParticleHandler<dim> particle_handler(
+    tr, mapping, DEM::get_number_properties());
+
+  // Defining physical properties
+  DEMSolverParameters<dim> dem_parameters;
+  auto &physical_properties = dem_parameters.physical_properties;
+
+  physical_properties.particle_type_number       = 1;
+  physical_properties.density[0]                 = 2500;
+  physical_properties.youngs_modulus_particle[0] = 10000000;
+  physical_properties.poisson_ratio_particle[0]  = 0.3;
+  physical_properties.youngs_modulus_wall        = 100000000;
+  physical_properties.poisson_ratio_wall         = 0.3;
+
+  // Inserting one particle at the center of the domain
+  Point<3> position1 = {0, 0, 0};
+  int      id        = 0;
+
+  Particles::Particle<dim> particle1(position1, position1, id);
+  typename Triangulation<dim>::active_cell_iterator particle_cell =
+    GridTools::find_active_cell_around_point(tr, particle1.get_location());
+  Particles::ParticleIterator<dim> pit =
+    particle_handler.insert_particle(particle1, particle_cell);
+
+  pit->get_properties()[DEM::PropertiesIndex::type] = 0;
+  pit->get_properties()[DEM::PropertiesIndex::dp]   = 0.005;
+  pit->get_properties()[DEM::PropertiesIndex::v_x]  = 0;
+  pit->get_properties()[DEM::PropertiesIndex::v_y]  = 0;
+  pit->get_properties()[DEM::PropertiesIndex::v_z]  = 0;
+  pit->get_properties()[DEM::PropertiesIndex::mass] = 0.0001;
+
+  std::unordered_map<
+    types::particle_index,
+    std::unordered_map<types::particle_index, pp_contact_info_struct<dim>>>
+    adjacent_particles;
+  std::unordered_map<
+    types::particle_index,
+    std::map<types::particle_index, pw_contact_info_struct<dim>>>
+    pw_pairs_in_contact, pfw_pairs_in_contact;
+
+  // Default fractions of the Rayleigh time step and of the collision time
+  const double rayleigh_time_step_ratio  = 0.15;
+  const double collision_time_resolution = 20;
+
+  // Without contact, the critical time step is a fraction of the Rayleigh
+  // time step
+  deallog << "Critical time step without contact: "
+          << find_critical_time_step<dim>(particle_handler,
+                                          physical_properties,
+                                          adjacent_particles,
+                                          adjacent_particles,
+                                          pw_pairs_in_contact,
+                                          pfw_pairs_in_contact,
+                                          rayleigh_time_step_ratio,
+                                          collision_time_resolution,
+                                          1,
+                                          MPI_COMM_WORLD)
+          << std::endl;
+
+  // Adding a fast particle-wall contact
+  pw_contact_info_struct<dim> contact_info;
+  contact_info.particle                 = pit;
+  contact_info.normal_overlap           = 0.00001;
+  contact_info.normal_relative_velocity = -500;
+  pw_pairs_in_contact[id].insert({0, contact_info});
+
+  deallog << "Critical time step with a particle-wall contact: "
+          << find_critical_time_step<dim>(particle_handler,
+                                          physical_properties,
+                                          adjacent_particles,
+                                          adjacent_particles,
+                                          pw_pairs_in_contact,
+                                          pfw_pairs_in_contact,
+                                          rayleigh_time_step_ratio,
+                                          collision_time_resolution,
+                                          1,
+                                          MPI_COMM_WORLD)
+          << std::endl;
+
+  // With sub-steps of the particle-wall contact forces, the collision time
+  // bounds the sub-step
+  deallog << "Critical time step with a particle-wall contact and two "
+             "sub-steps: "
+          << find_critical_time_step<dim>(particle_handler,
+                                          physical_properties,
+                                          adjacent_particles,
+                                          adjacent_particles,
+                                          pw_pairs_in_contact,
+                                          pfw_pairs_in_contact,
+                                          rayleigh_time_step_ratio,
+                                          collision_time_resolution,
+                                          2,
+                                          MPI_COMM_WORLD)
+          << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      initlog();
+      test<3>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
@@ -39,7 +39,7 @@
 
 // Lethe
 #include <dem/dem_properties.h>
-#include <dem/gear3_integrator.h>
+#include <dem/gear_integrator.h>
 
 // Tests (with common definitions)
 #include <../tests/tests.h>
@@ -50,77 +50,74 @@ template <int dim>
 void
 test()
 {
-  /*
-// Creating the mesh and refinement
-parallel::distributed::Triangulation<dim> tr(MPI_COMM_WORLD);
-int                                       hyper_cube_length = 1;
-GridGenerator::hyper_cube(tr,
-                          -1 * hyper_cube_length,
-                          hyper_cube_length,
-                          true);
-int refinement_number = 2;
-tr.refine_global(refinement_number);
-MappingQ<dim> mapping(1);
-
-// Defining simulation general parameters
-Tensor<1, dim> g{{0, 0, -9.81}};
-double         dt = 0.00001;
-
-// Defning particle handler
-Particles::ParticleHandler<dim> particle_handler(
-  tr, mapping, DEM::get_number_properties());
-
-// inserting one particle at x = 0 , y = 0 and z = 0 m
-// initial velocity of particles = 0, 0, 0 m/s
-// gravitational acceleration = 0, 0, -9.81 m/s2
-Point<3> position1 = {0, 0, 0};
-int      id        = 0;
-
-Particles::Particle<dim> particle1(position1, position1, id);
-typename Triangulation<dim>::active_cell_iterator particle_cell =
-  GridTools::find_active_cell_around_point(tr, particle1.get_location());
-
-// Inserting one particle and defining its properties
-Particles::ParticleIterator<dim> pit =
-  particle_handler.insert_particle(particle1, particle_cell);
-
-pit->get_properties()[DEM::PropertiesIndex::type]             = 1;
-pit->get_properties()[DEM::PropertiesIndex::dp]               = 0.005;
-pit->get_properties()[DEM::PropertiesIndex::rho]              = 2500;
-pit->get_properties()[DEM::PropertiesIndex::v_x]              = 0;
-pit->get_properties()[DEM::PropertiesIndex::v_y]              = 0;
-pit->get_properties()[DEM::PropertiesIndex::v_z]              = 0;
-pit->get_properties()[DEM::PropertiesIndex::acc_x]            = 0;
-pit->get_properties()[DEM::PropertiesIndex::acc_y]            = 0;
-pit->get_properties()[DEM::PropertiesIndex::acc_z]            = -9.81;
-pit->get_properties()[DEM::PropertiesIndex::force_x]          = 0;
-pit->get_properties()[DEM::PropertiesIndex::force_y]          = 0;
-pit->get_properties()[DEM::PropertiesIndex::force_z]          = 0;
-pit->get_properties()[DEM::PropertiesIndex::omega_x]          = 0;
-pit->get_properties()[DEM::PropertiesIndex::omega_y]          = 0;
-pit->get_properties()[DEM::PropertiesIndex::omega_z]          = 0;
-pit->get_properties()[DEM::PropertiesIndex::mass]             = 1;
-pit->get_properties()[DEM::PropertiesIndex::mom_inertia]      = 1;
-pit->get_properties()[DEM::PropertiesIndex::acc_derivative_x] = 0;
-pit->get_properties()[DEM::PropertiesIndex::acc_derivative_y] = 0;
-pit->get_properties()[DEM::PropertiesIndex::acc_derivative_z] = 0;
-
-// Calling gear3 integrator
-Gear3Integrator<dim> integration_object;
-integration_object.integrate_pre_force(particle_handler, g, dt);
-integration_object.integrate_post_force(particle_handler, g, dt);
-
-// Output
-for (auto particle_iterator = particle_handler.begin();
-     particle_iterator != particle_handler.end();
-     ++particle_iterator)
-  {
-    deallog << "The new position of the particle in z direction after " << dt
-            << " seconds is: " << particle_iterator->get_location()[2]
-            << std::endl;
-  }
-  */
-  deallog << "Test deactivated" << std::endl;
+  // Creating the mesh and refinement
+  parallel::distributed::Triangulation<dim> tr(MPI_COMM_WORLD);
+  int                                       hyper_cube_length = 1;
+  GridGenerator::hyper_cube(tr,
+                            -1 * hyper_cube_length,
+                            hyper_cube_length,
+                            true);
+  int refinement_number = 2;
+  tr.refine_global(refinement_number);
+  MappingQ<dim> mapping(1);
+
+  // Defining simulation general parameters
+  Tensor<1, dim> g{{0, 0, -9.81}};
+  double         dt          = 0.00001;
+  unsigned int   n_time_step = 10;
+
+  // Defning particle handler
+  Particles::ParticleHandler<dim> particle_handler(
+    tr, mapping, DEM::get_number_properties());
+
+  // inserting one particle at x = 0 , y = 0 and z = 0 m
+  // initial velocity of particles = 0, 0, 0 m/s
+  // gravitational acceleration = 0, 0, -9.81 m/s2
+  Point<3> position1 = {0, 0, 0};
+  int      id        = 0;
+
+  DEMSolverParameters<dim> dem_parameters;
+  dem_parameters.physical_properties.particle_type_number = 1;
+  dem_parameters.physical_properties.density[0]           = 2500;
+
+  Particles::Particle<dim> particle1(position1, position1, id);
+  typename Triangulation<dim>::active_cell_iterator particle_cell =
+    GridTools::find_active_cell_around_point(tr, particle1.get_location());
+
+  // Inserting one particle and defining its properties
+  Particles::ParticleIterator<dim> pit =
+    particle_handler.insert_particle(particle1, particle_cell);
+
+  pit->get_properties()[DEM::PropertiesIndex::type]    = 1;
+  pit->get_properties()[DEM::PropertiesIndex::dp]      = 0.005;
+  pit->get_properties()[DEM::PropertiesIndex::v_x]     = 0;
+  pit->get_properties()[DEM::PropertiesIndex::v_y]     = 0;
+  pit->get_properties()[DEM::PropertiesIndex::v_z]     = 0;
+  pit->get_properties()[DEM::PropertiesIndex::omega_x] = 0;
+  pit->get_properties()[DEM::PropertiesIndex::omega_y] = 0;
+  pit->get_properties()[DEM::PropertiesIndex::omega_z] = 0;
+  pit->get_properties()[DEM::PropertiesIndex::mass]    = 1;
+
+  std::unordered_map<unsigned int, Tensor<1, dim>> momentum;
+  std::unordered_map<unsigned int, Tensor<1, dim>> force;
+  std::unordered_map<unsigned int, double>         MOI;
+  MOI.insert({0, 1});
+
+  // Calling Gear3 integrator, which is exact for a constant acceleration
+  GearIntegrator<dim> integration_object(3);
+  for (unsigned int step = 0; step < n_time_step; ++step)
+    integration_object.integrate(particle_handler, g, dt, momentum, force, MOI);
+
+  // Output
+  for (auto particle_iterator = particle_handler.begin();
+       particle_iterator != particle_handler.end();
+       ++particle_iterator)
+    {
+      deallog << "The new position of the particle in z direction after "
+              << n_time_step << " time steps of " << dt
+              << " seconds is: " << particle_iterator->get_location()[2]
+              << std::endl;
+    }
 }
 
 int
@@ -0,0 +1,269 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2021 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+
+ *
+ * Author: Shahab Golshan, Polytechnique Montreal, 2019-
+ */
+
+/**
+ * @brief This test checks the multiple time step integrator with a particle
+ * falling under gravity on a wall, modeled as a stiff linear spring. The
+ * spring force is recalculated at each sub-step from the position of the
+ * particle. The trajectory is compared to the one of a single rate velocity
+ * verlet integration with the sub-step, and the multiple time step
+ * integrator with a single sub-step is compared to the velocity verlet
+ * integrator with the same time step. The contact lasts about three time
+ * steps, so the error on the position of the particle with the multiple time
+ * step integrator must be much smaller than with the time step alone. The
+ * velocities of the multiple time step integrator are half a time step of
+ * the body force ahead of those of the reference, so the errors are
+ * measured on the position.
+ */
+
+// Deal.II includes
+#include <deal.II/base/parameter_handler.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/particle.h>
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/particle_iterator.h>
+#include <deal.II/particles/property_pool.h>
+
+// Lethe
+#include <dem/dem_properties.h>
+#include <dem/multiple_time_step_integrator.h>
+#include <dem/velocity_verlet_integrator.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+using namespace dealii;
+
+template <int dim>
+void
+test()
+{
+  // Creating the mesh and refinement
+  parallel::distributed::Triangulation<dim> tr(MPI_COMM_WORLD);
+  int                                       hyper_cube_length = 1;
+  GridGenerator::hyper_cube(tr,
+                            -1 * hyper_cube_length,
+                            hyper_cube_length,
+                            true);
+  int refinement_number = 2;
+  tr.refine_global(refinement_number);
+  MappingQ<dim> mapping(1);
+
+  // Defining simulation general parameters
+  Tensor<1, dim>     g{{0, 0, -9.81}};
+  double             dt          = 0.001;
+  unsigned int       n_time_step = 50;
+  const unsigned int n_sub_steps = 100;
+
+  // The wall is the plane z = 0 and its contact with the particle is a
+  // linear spring whose stiffness gives a contact duration of about three
+  // time steps
+  const double particle_diameter = 0.01;
+  const double wall_stiffness    = 1e6;
+  const double initial_height    = 0.01;
+  const int    id                = 0;
+
+  // Defning particle handler
+  Particles::ParticleHandler<dim> particle_handler(
+    tr, mapping, DEM::get_number_properties());
+
+  DEMSolverParameters<dim> dem_parameters;
+  dem_parameters.physical_properties.particle_type_number = 1;
+
+  // Inserts the particle at rest at its initial height
+  auto insert_particle = [&]() {
+    particle_handler.clear_particles();
+    Point<3>                 position = {0, 0, initial_height};
+    Particles::Particle<dim> particle(position, position, id);
+    typename Triangulation<dim>::active_cell_iterator particle_cell =
+      GridTools::find_active_cell_around_point(tr, particle.get_location());
+
+    Particles::ParticleIterator<dim> pit =
+      particle_handler.insert_particle(particle, particle_cell);
+
+    pit->get_properties()[DEM::PropertiesIndex::type]    = 1;
+    pit->get_properties()[DEM::PropertiesIndex::dp]      = particle_diameter;
+    pit->get_properties()[DEM::PropertiesIndex::v_x]     = 0;
+    pit->get_properties()[DEM::PropertiesIndex::v_y]     = 0;
+    pit->get_properties()[DEM::PropertiesIndex::v_z]     = 0;
+    pit->get_properties()[DEM::PropertiesIndex::omega_x] = 0;
+    pit->get_properties()[DEM::PropertiesIndex::omega_y] = 0;
+    pit->get_properties()[DEM::PropertiesIndex::omega_z] = 0;
+    pit->get_properties()[DEM::PropertiesIndex::mass]    = 1;
+  };
+
+  std::unordered_map<unsigned int, Tensor<1, dim>> momentum;
+  std::unordered_map<unsigned int, Tensor<1, dim>> force;
+  std::unordered_map<unsigned int, double>         MOI;
+  MOI.insert({0, 1});
+
+  // Calculates the particle-wall spring force at the current position of the
+  // particle
+  auto calculate_wall_force = [&]() {
+    const double overlap = 0.5 * particle_diameter -
+                           particle_handler.begin()->get_location()[dim - 1];
+    force[id][dim - 1] = overlap > 0 ? wall_stiffness * overlap : 0;
+  };
+
+  auto position = [&]() {
+    return particle_handler.begin()->get_location()[dim - 1];
+  };
+
+  auto output = [&](const std::string &label) {
+    deallog << label << ", position: "
+            << particle_handler.begin()->get_location()[dim - 1]
+            << ", velocity: "
+            << particle_handler.begin()
+                 ->get_properties()[DEM::PropertiesIndex::v_z]
+            << std::endl;
+  };
+
+  // Single rate velocity verlet integration with the sub-step, used as
+  // reference
+  const double sub_time_step = dt / n_sub_steps;
+  {
+    insert_particle();
+    VelocityVerletIntegrator<dim> integration_object;
+    calculate_wall_force();
+    integration_object.integrate_half_step_location(particle_handler,
+                                                    g,
+                                                    force,
+                                                    sub_time_step);
+    for (unsigned int step = 1; step < n_time_step * n_sub_steps; ++step)
+      {
+        calculate_wall_force();
+        integration_object.integrate(
+          particle_handler, g, sub_time_step, momentum, force, MOI);
+      }
+    output("Velocity verlet with the sub-step");
+  }
+  const double reference_position = position();
+
+  // Multiple time step integration, the body force is applied with the time
+  // step and the wall force, recalculated at each sub-step, with the
+  // sub-steps
+  {
+    insert_particle();
+    MultipleTimeStepIntegrator<dim> integration_object(n_sub_steps);
+    for (unsigned int step = 0; step < n_time_step; ++step)
+      {
+        integration_object.integrate_slow_forces(
+          particle_handler, g, dt, momentum, force, MOI, step == 0);
+
+        for (unsigned int sub_step = 0; sub_step < n_sub_steps; ++sub_step)
+          {
+            calculate_wall_force();
+            integration_object.integrate_fast_forces(
+              particle_handler,
+              integration_object.get_sub_time_step(dt),
+              momentum,
+              force,
+              MOI,
+              step == 0 && sub_step == 0);
+          }
+      }
+    output("Multiple time step");
+  }
+  const double multiple_time_step_error =
+    std::abs(position() - reference_position);
+
+  // With a single sub-step, the multiple time step integrator is the velocity
+  // verlet integrator
+  {
+    insert_particle();
+    MultipleTimeStepIntegrator<dim> integration_object(1);
+    for (unsigned int step = 0; step < n_time_step; ++step)
+      {
+        integration_object.integrate_slow_forces(
+          particle_handler, g, dt, momentum, force, MOI, step == 0);
+        calculate_wall_force();
+        integration_object.integrate_fast_forces(
+          particle_handler, dt, momentum, force, MOI, step == 0);
+      }
+    output("Multiple time step with a single sub-step");
+  }
+
+  {
+    insert_particle();
+    VelocityVerletIntegrator<dim> integration_object;
+    calculate_wall_force();
+    integration_object.integrate_half_step_location(particle_handler,
+                                                    g,
+                                                    force,
+                                                    dt);
+    for (unsigned int step = 1; step < n_time_step; ++step)
+      {
+        calculate_wall_force();
+        integration_object.integrate(
+          particle_handler, g, dt, momentum, force, MOI);
+      }
+    output("Velocity verlet with the time step");
+  }
+  const double time_step_error = std::abs(position() - reference_position);
+
+  deallog << "Multiple time step position error below a tenth of the time "
+             "step position error: "
+          << (multiple_time_step_error < 0.1 * time_step_error ? "true" :
+                                                                 "false")
+          << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      initlog();
+      test<3>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
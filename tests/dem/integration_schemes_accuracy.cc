@@ -39,7 +39,7 @@
 // Lethe
 #include <dem/dem_properties.h>
 #include <dem/explicit_euler_integrator.h>
-#include <dem/gear3_integrator.h>
+#include <dem/gear_integrator.h>
 #include <dem/velocity_verlet_integrator.h>
 
 // Tests (with common definitions)
@@ -90,8 +90,11 @@ test()
   double   particle_axial_position_error_Euler_dt2;
   double   particle_axial_position_error_Verlet_dt1;
   double   particle_axial_position_error_Verlet_dt2;
-  double   particle_axial_position_error_Gear3_dt1;
-  double   particle_axial_position_error_Gear3_dt2;
+  double   v_analytical;
+  double   particle_axial_velocity_error_Gear3_dt1;
+  double   particle_axial_velocity_error_Gear3_dt2;
+  double   particle_axial_velocity_error_Gear5_dt1;
+  double   particle_axial_velocity_error_Gear5_dt2;
 
   Particles::Particle<dim> particle0(position1, position1, id);
   typename Triangulation<dim>::active_cell_iterator particle0_cell =
@@ -109,7 +112,21 @@ test()
   // Calling integrators
   ExplicitEulerIntegrator<dim>  explicit_euler_object;
   VelocityVerletIntegrator<dim> velocity_verlet_object;
-  Gear3Integrator<dim>          gear3_integration_object;
+
+  // The Gear integrators store the history of the particles, a new object is
+  // therefore used for each time step
+  GearIntegrator<dim> gear3_dt1_object(3);
+  GearIntegrator<dim> gear3_dt2_object(3);
+  GearIntegrator<dim> gear5_dt1_object(5);
+  GearIntegrator<dim> gear5_dt2_object(5);
+
+  // The history of the Gear integrators is started from the derivatives of
+  // the analytical acceleration, -x0 * w ^ 2 * cos(w * t), at t = 0 rather
+  // than from zero derivatives, which would limit their accuracy
+  const double angular_frequency_squared = spring_constant / particle_mass;
+  std::vector<Tensor<1, dim>> acceleration_derivatives(3);
+  acceleration_derivatives[1][dim - 1] =
+    x0 * angular_frequency_squared * angular_frequency_squared;
 
   std::unordered_map<unsigned int, Tensor<1, dim>> momentum;
   std::unordered_map<unsigned int, Tensor<1, dim>> force;
@@ -175,9 +192,9 @@ test()
         particle_iterator->get_location()[dim - 1] - x_analytical;
     }
   deallog << "Explicit Euler is a "
-          << std::abs(particle_axial_position_error_Euler_dt1 /
-                      particle_axial_position_error_Euler_dt2) /
-               time_step_ratio
+          << std::log(std::abs(particle_axial_position_error_Euler_dt1 /
+                               particle_axial_position_error_Euler_dt2)) /
+               std::log(time_step_ratio)
           << " order integration scheme" << std::endl;
 
   particle_handler.clear_particles();
@@ -270,113 +287,194 @@ test()
     }
 
   deallog << "Velocity Verlet is a "
-          << std::abs(particle_axial_position_error_Verlet_dt1 /
-                      particle_axial_position_error_Verlet_dt2) /
-               time_step_ratio
+          << std::log(std::abs(particle_axial_position_error_Verlet_dt1 /
+                               particle_axial_position_error_Verlet_dt2)) /
+               std::log(time_step_ratio)
           << " order integration scheme" << std::endl;
 
-  // This part of test for gear3 integration scheme is deactivated
-  /*
-    particle_handler.clear_particles();
-    Particles::Particle<dim> particle4(position1, position1, id);
-    typename Triangulation<dim>::active_cell_iterator particle4_cell =
-      GridTools::find_active_cell_around_point(tr, particle4.get_location());
-
-    // Inserting one particle and defining its properties
-    Particles::ParticleIterator<dim> pit4 =
-      particle_handler.insert_particle(particle4, particle4_cell);
-
-    pit4->get_properties()[DEM::PropertiesIndex::v_x]         = 0;
-    pit4->get_properties()[DEM::PropertiesIndex::v_y]         = 0;
-    pit4->get_properties()[DEM::PropertiesIndex::v_z]         = 0;
-    pit4->get_properties()[DEM::PropertiesIndex::acc_x]       = 0;
-    pit4->get_properties()[DEM::PropertiesIndex::acc_y]       = 0;
-    pit4->get_properties()[DEM::PropertiesIndex::acc_z]       = 0;
-    pit4->get_properties()[DEM::PropertiesIndex::force_x]     = 0;
-    pit4->get_properties()[DEM::PropertiesIndex::force_y]     = 0;
-    pit4->get_properties()[DEM::PropertiesIndex::force_z]     = 0;
-    pit4->get_properties()[DEM::PropertiesIndex::mass]        = particle_mass;
-    pit4->get_properties()[DEM::PropertiesIndex::mom_inertia] = 1;
-
-    // Output Gear3
-    for (auto particle_iterator = particle_handler.begin();
-         particle_iterator != particle_handler.end();
-         ++particle_iterator)
-      {
-        auto particle_properties = particle_iterator->get_properties();
-        t                        = 0;
-        while (t < t_final)
-          {
-            particle_properties[DEM::PropertiesIndex::acc_z] =
-              -spring_constant * particle_iterator->get_location()[2];
-            gear3_integration_object.integrate_pre_force(particle_handler,
-                                                         g,
-                                                         dt1);
-            particle_properties[DEM::PropertiesIndex::force_z] =
-              -spring_constant * particle_iterator->get_location()[2];
-            gear3_integration_object.integrate_post_force(particle_handler,
-                                                          g,
-                                                          dt1);
+  particle_handler.clear_particles();
+  Particles::Particle<dim> particle4(position1, position1, id);
+  typename Triangulation<dim>::active_cell_iterator particle4_cell =
+    GridTools::find_active_cell_around_point(tr, particle4.get_location());
 
-            t += dt1;
-          }
-        particle_axial_position_error_Gear3_dt1 =
-          particle_iterator->get_location()[2] - x_analytical;
-      }
-
-    particle_handler.clear_particles();
-    Particles::Particle<dim> particle5(position1, position1, id);
-    typename Triangulation<dim>::active_cell_iterator particle5_cell =
-      GridTools::find_active_cell_around_point(tr, particle5.get_location());
-
-    // Inserting one particle and defining its properties
-    Particles::ParticleIterator<dim> pit5 =
-      particle_handler.insert_particle(particle5, particle5_cell);
-
-    pit5->get_properties()[DEM::PropertiesIndex::v_x]         = 0;
-    pit5->get_properties()[DEM::PropertiesIndex::v_y]         = 0;
-    pit5->get_properties()[DEM::PropertiesIndex::v_z]         = 0;
-    pit5->get_properties()[DEM::PropertiesIndex::acc_x]       = 0;
-    pit5->get_properties()[DEM::PropertiesIndex::acc_y]       = 0;
-    pit5->get_properties()[DEM::PropertiesIndex::acc_z]       = 0;
-    pit5->get_properties()[DEM::PropertiesIndex::force_x]     = 0;
-    pit5->get_properties()[DEM::PropertiesIndex::force_y]     = 0;
-    pit5->get_properties()[DEM::PropertiesIndex::force_z]     = 0;
-    pit5->get_properties()[DEM::PropertiesIndex::mass]        = particle_mass;
-    pit5->get_properties()[DEM::PropertiesIndex::mom_inertia] = 1;
-
-    // Output Gear3
-    for (auto particle_iterator = particle_handler.begin();
-         particle_iterator != particle_handler.end();
-         ++particle_iterator)
-      {
-        auto particle_properties = particle_iterator->get_properties();
-        t                        = 0;
-        while (t < t_final)
-          {
-            particle_properties[DEM::PropertiesIndex::acc_z] =
-              -spring_constant * particle_iterator->get_location()[2];
-            gear3_integration_object.integrate_pre_force(particle_handler,
-                                                         g,
-                                                         dt2);
-            particle_properties[DEM::PropertiesIndex::force_z] =
-              -spring_constant * particle_iterator->get_location()[2];
-            gear3_integration_object.integrate_post_force(particle_handler,
-                                                          g,
-                                                          dt2);
+  // Inserting one particle and defining its properties
+  Particles::ParticleIterator<dim> pit4 =
+    particle_handler.insert_particle(particle4, particle4_cell);
+
+  pit4->get_properties()[DEM::PropertiesIndex::v_x]  = 0;
+  pit4->get_properties()[DEM::PropertiesIndex::v_y]  = 0;
+  pit4->get_properties()[DEM::PropertiesIndex::v_z]  = 0;
+  pit4->get_properties()[DEM::PropertiesIndex::mass] = particle_mass;
+
+  // The order of the Gear schemes is measured on the velocity, on which the
+  // damped contact forces depend. For a force which only depends on the
+  // position, as this spring force, the position of the third order scheme
+  // converges faster than its order
+  // Output Gear3
+  for (auto particle_iterator = particle_handler.begin();
+       particle_iterator != particle_handler.end();
+       ++particle_iterator)
+    {
+      t = 0;
+
+      gear3_dt1_object.start_particle_history(particle_iterator->get_id(),
+                                              acceleration_derivatives);
+
+      while (t < t_final)
+        {
+          Tensor<1, dim> force_tensor;
+          force_tensor[dim - 1] =
+            -spring_constant * particle_iterator->get_location()[dim - 1];
+          force[particle_iterator->get_id()] = force_tensor;
+          gear3_dt1_object.integrate(
+            particle_handler, g, dt1, momentum, force, MOI);
+          t += dt1;
+        }
+      // Output Analytical
+      v_analytical = -x0 * sqrt(spring_constant / particle_mass) *
+                     sin(sqrt(spring_constant / particle_mass) * (t));
+      particle_axial_velocity_error_Gear3_dt1 =
+        particle_iterator->get_properties()[DEM::PropertiesIndex::v_z] -
+        v_analytical;
+    }
+
+  particle_handler.clear_particles();
+  Particles::Particle<dim> particle5(position1, position1, id);
+  typename Triangulation<dim>::active_cell_iterator particle5_cell =
+    GridTools::find_active_cell_around_point(tr, particle5.get_location());
+
+  // Inserting one particle and defining its properties
+  Particles::ParticleIterator<dim> pit5 =
+    particle_handler.insert_particle(particle5, particle5_cell);
+
+  pit5->get_properties()[DEM::PropertiesIndex::v_x]  = 0;
+  pit5->get_properties()[DEM::PropertiesIndex::v_y]  = 0;
+  pit5->get_properties()[DEM::PropertiesIndex::v_z]  = 0;
+  pit5->get_properties()[DEM::PropertiesIndex::mass] = particle_mass;
+
+  // Output Gear3
+  for (auto particle_iterator = particle_handler.begin();
+       particle_iterator != particle_handler.end();
+       ++particle_iterator)
+    {
+      t = 0;
+
+      gear3_dt2_object.start_particle_history(particle_iterator->get_id(),
+                                              acceleration_derivatives);
+
+      while (t < t_final)
+        {
+          Tensor<1, dim> force_tensor;
+          force_tensor[dim - 1] =
+            -spring_constant * particle_iterator->get_location()[dim - 1];
+          force[particle_iterator->get_id()] = force_tensor;
+          gear3_dt2_object.integrate(
+            particle_handler, g, dt2, momentum, force, MOI);
+          t += dt2;
+        }
+      // Output Analytical
+      v_analytical = -x0 * sqrt(spring_constant / particle_mass) *
+                     sin(sqrt(spring_constant / particle_mass) * (t));
+      particle_axial_velocity_error_Gear3_dt2 =
+        particle_iterator->get_properties()[DEM::PropertiesIndex::v_z] -
+        v_analytical;
+    }
+
+  deallog << "Gear3 is a "
+          << std::log(std::abs(particle_axial_velocity_error_Gear3_dt1 /
+                               particle_axial_velocity_error_Gear3_dt2)) /
+               std::log(time_step_ratio)
+          << " order integration scheme" << std::endl;
+
+  particle_handler.clear_particles();
+  Particles::Particle<dim> particle6(position1, position1, id);
+  typename Triangulation<dim>::active_cell_iterator particle6_cell =
+    GridTools::find_active_cell_around_point(tr, particle6.get_location());
+
+  // Inserting one particle and defining its properties
+  Particles::ParticleIterator<dim> pit6 =
+    particle_handler.insert_particle(particle6, particle6_cell);
+
+  pit6->get_properties()[DEM::PropertiesIndex::v_x]  = 0;
+  pit6->get_properties()[DEM::PropertiesIndex::v_y]  = 0;
+  pit6->get_properties()[DEM::PropertiesIndex::v_z]  = 0;
+  pit6->get_properties()[DEM::PropertiesIndex::mass] = particle_mass;
+
+  // Output Gear5
+  for (auto particle_iterator = particle_handler.begin();
+       particle_iterator != particle_handler.end();
+       ++particle_iterator)
+    {
+      t = 0;
+
+      gear5_dt1_object.start_particle_history(particle_iterator->get_id(),
+                                              acceleration_derivatives);
+
+      while (t < t_final)
+        {
+          Tensor<1, dim> force_tensor;
+          force_tensor[dim - 1] =
+            -spring_constant * particle_iterator->get_location()[dim - 1];
+          force[particle_iterator->get_id()] = force_tensor;
+          gear5_dt1_object.integrate(
+            particle_handler, g, dt1, momentum, force, MOI);
+          t += dt1;
+        }
+      // Output Analytical
+      v_analytical = -x0 * sqrt(spring_constant / particle_mass) *
+                     sin(sqrt(spring_constant / particle_mass) * (t));
+      particle_axial_velocity_error_Gear5_dt1 =
+        particle_iterator->get_properties()[DEM::PropertiesIndex::v_z] -
+        v_analytical;
+    }
 
-            t += dt2;
-          }
-        particle_axial_position_error_Gear3_dt2 =
-          particle_iterator->get_location()[2] - x_analytical;
-      }
-
-    deallog << "Gear3 is a "
-            << (particle_axial_position_error_Gear3_dt1 /
-                particle_axial_position_error_Gear3_dt2) /
-                 time_step_ratio
-            << " order integration scheme" << std::endl;
-            */
+  particle_handler.clear_particles();
+  Particles::Particle<dim> particle7(position1, position1, id);
+  typename Triangulation<dim>::active_cell_iterator particle7_cell =
+    GridTools::find_active_cell_around_point(tr, particle7.get_location());
+
+  // Inserting one particle and defining its properties
+  Particles::ParticleIterator<dim> pit7 =
+    particle_handler.insert_particle(particle7, particle7_cell);
+
+  pit7->get_properties()[DEM::PropertiesIndex::v_x]  = 0;
+  pit7->get_properties()[DEM::PropertiesIndex::v_y]  = 0;
+  pit7->get_properties()[DEM::PropertiesIndex::v_z]  = 0;
+  pit7->get_properties()[DEM::PropertiesIndex::mass] = particle_mass;
+
+  // Output Gear5
+  for (auto particle_iterator = particle_handler.begin();
+       particle_iterator != particle_handler.end();
+       ++particle_iterator)
+    {
+      t = 0;
+
+      gear5_dt2_object.start_particle_history(particle_iterator->get_id(),
+                                              acceleration_derivatives);
+
+      while (t < t_final)
+        {
+          Tensor<1, dim> force_tensor;
+          force_tensor[dim - 1] =
+            -spring_constant * particle_iterator->get_location()[dim - 1];
+          force[particle_iterator->get_id()] = force_tensor;
+          gear5_dt2_object.integrate(
+            particle_handler, g, dt2, momentum, force, MOI);
+          t += dt2;
+        }
+      // Output Analytical
+      v_analytical = -x0 * sqrt(spring_constant / particle_mass) *
+                     sin(sqrt(spring_constant / particle_mass) * (t));
+      particle_axial_velocity_error_Gear5_dt2 =
+        particle_iterator->get_properties()[DEM::PropertiesIndex::v_z] -
+        v_analytical;
+    }
+
+  deallog << "Gear5 is a "
+          << std::log(std::abs(particle_axial_velocity_error_Gear5_dt1 /
+                               particle_axial_velocity_error_Gear5_dt2)) /
+               std::log(time_step_ratio)
+          << " order integration scheme" << std::endl;
 }
 
 int
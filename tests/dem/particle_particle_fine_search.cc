@@ -177,11 +177,6 @@ test()
                   << " and "
                   << information_iterator->second.particle_two->get_id()
                   << std::endl;
-          deallog << "Tangential overlap at the beginning of contact is: "
-                  << information_iterator->second.tangential_overlap[0] << " "
-                  << information_iterator->second.tangential_overlap[1] << " "
-                  << information_iterator->second.tangential_overlap[2]
-                  << std::endl;
           ++information_iterator;
         }
     }